@@ -0,0 +1,64 @@
+#include <benchmark/benchmark.h>
+#include <lexer/Lexer.hpp>
+#include <utils/SourceGenerator.hpp>
+
+static auto lex_all(benchmark::State& state, const std::string& source) -> void
+{
+    std::size_t tokens = 0;
+
+    for(auto _ : state) {
+        lexing::Lexer lexer{source};
+
+        while(auto token = lexer.peek()) {
+            if(token.value().getType() == lexing::TokenTypes::END_OF_FILE) {
+                break;
+            }
+            benchmark::DoNotOptimize(token);
+            lexer.pop();
+            tokens++;
+        }
+    }
+
+    state.SetItemsProcessed(tokens);
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static auto tokenize_all(benchmark::State& state, const std::string& source) -> void
+{
+    std::size_t tokens = 0;
+
+    for(auto _ : state) {
+        auto buffer = lexing::Lexer{source}.tokenize_all();
+        benchmark::DoNotOptimize(buffer.getTypes().data());
+        tokens += buffer.size();
+    }
+
+    state.SetItemsProcessed(tokens);
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static auto BM_LexWholeSource(benchmark::State& state) -> void
+{
+    lex_all(state, benchmarks::generate_source(state.range(0)));
+}
+BENCHMARK(BM_LexWholeSource)->Arg(1000)->Arg(100000);
+
+static auto BM_TokenizeAll(benchmark::State& state) -> void
+{
+    tokenize_all(state, benchmarks::generate_source(state.range(0)));
+}
+BENCHMARK(BM_TokenizeAll)->Arg(1000)->Arg(100000);
+
+static auto BM_LexLongIdentifiers(benchmark::State& state) -> void
+{
+    lex_all(state, benchmarks::generate_long_identifier_source(state.range(0)));
+}
+BENCHMARK(BM_LexLongIdentifiers)->Arg(1000)->Arg(100000);
+
+static auto BM_LexStrings(benchmark::State& state) -> void
+{
+    lex_all(state, benchmarks::generate_string_source(state.range(0)));
+}
+BENCHMARK(BM_LexStrings)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
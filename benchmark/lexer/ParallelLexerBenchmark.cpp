@@ -0,0 +1,42 @@
+#include <benchmark/benchmark.h>
+#include <lexer/Lexer.hpp>
+#include <lexer/ParallelLexer.hpp>
+#include <tbb/task_arena.h>
+#include <thread>
+#include <utils/SourceGenerator.hpp>
+
+// about 100MB of source
+static const auto source = benchmarks::generate_source(1'000'000);
+
+static auto BM_TokenizeSerial(benchmark::State& state) -> void
+{
+    for(auto _ : state) {
+        auto buffer = lexing::Lexer{source}.tokenize_all();
+        benchmark::DoNotOptimize(buffer.getTypes().data());
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_TokenizeSerial)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// the argument is the number of threads the parallel lexer is allowed to use
+static auto BM_TokenizeParallel(benchmark::State& state) -> void
+{
+    tbb::task_arena arena{static_cast<int>(state.range(0))};
+
+    for(auto _ : state) {
+        arena.execute([&] {
+            auto buffer = lexing::tokenize_parallel(source);
+            benchmark::DoNotOptimize(buffer.getTypes().data());
+        });
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_TokenizeParallel)
+    ->RangeMultiplier(2)
+    ->Range(1, 2 * std::max(1u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
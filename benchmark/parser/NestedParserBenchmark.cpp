@@ -0,0 +1,49 @@
+#include <ast/Arena.hpp>
+#include <benchmark/benchmark.h>
+#include <parser/Parser.hpp>
+#include <string>
+#include <utils/SourceGenerator.hpp>
+
+// parses deeply nested sources with increasing depth.
+// lambdas and tuples start the same way and are told apart by parsing the lambda head
+// speculatively, the reported complexity shows that no region is parsed more than a constant number of times
+static auto parse_nested(benchmark::State& state, const std::string& source) -> void
+{
+    // every level of nesting counts a few times against the limit
+    const auto max_depth = static_cast<std::uint32_t>(state.range(0) * 4);
+
+    for(auto _ : state) {
+        ast::Arena arena;
+        parser::Parser parser{source, arena};
+        auto result = parser.set_max_nesting_depth(max_depth).expression();
+
+        if(not result.has_value()) {
+            state.SkipWithError("nested source did not parse");
+            break;
+        }
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetComplexityN(state.range(0));
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static auto BM_ParseNestedLambdas(benchmark::State& state) -> void
+{
+    parse_nested(state, benchmarks::generate_nested_lambda_source(state.range(0)));
+}
+BENCHMARK(BM_ParseNestedLambdas)->RangeMultiplier(2)->Range(64, 1024)->Complexity();
+
+static auto BM_ParseNestedTuples(benchmark::State& state) -> void
+{
+    parse_nested(state, benchmarks::generate_nested_tuple_source(state.range(0)));
+}
+BENCHMARK(BM_ParseNestedTuples)->RangeMultiplier(2)->Range(64, 1024)->Complexity();
+
+static auto BM_ParseNestedBlocks(benchmark::State& state) -> void
+{
+    parse_nested(state, benchmarks::generate_nested_block_source(state.range(0)));
+}
+BENCHMARK(BM_ParseNestedBlocks)->RangeMultiplier(2)->Range(64, 1024)->Complexity();
+
+BENCHMARK_MAIN();
@@ -0,0 +1,44 @@
+#include <ast/Arena.hpp>
+#include <benchmark/benchmark.h>
+#include <parser/ParallelParser.hpp>
+#include <parser/Parser.hpp>
+#include <tbb/task_arena.h>
+#include <thread>
+#include <utils/SourceGenerator.hpp>
+
+// about 50MB of source
+static const auto source = benchmarks::generate_module_source(1'000'000);
+
+static auto BM_ParseModuleSerial(benchmark::State& state) -> void
+{
+    for(auto _ : state) {
+        ast::Arena arena;
+        auto result = parser::Parser{source, arena}.toplevel();
+        benchmark::DoNotOptimize(result);
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_ParseModuleSerial)->Unit(benchmark::kMillisecond)->UseRealTime();
+
+// the argument is the number of threads lexing and parsing are allowed to use
+static auto BM_ParseModuleParallel(benchmark::State& state) -> void
+{
+    tbb::task_arena arena{static_cast<int>(state.range(0))};
+
+    for(auto _ : state) {
+        arena.execute([&] {
+            auto result = parser::parse_parallel(source);
+            benchmark::DoNotOptimize(result);
+        });
+    }
+
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+BENCHMARK(BM_ParseModuleParallel)
+    ->RangeMultiplier(2)
+    ->Range(1, 2 * std::max(1u, std::thread::hardware_concurrency()))
+    ->Unit(benchmark::kMillisecond)
+    ->UseRealTime();
+
+BENCHMARK_MAIN();
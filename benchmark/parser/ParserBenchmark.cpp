@@ -0,0 +1,72 @@
+#include <ast/Arena.hpp>
+#include <atomic>
+#include <benchmark/benchmark.h>
+#include <cstdlib>
+#include <new>
+#include <parser/Parser.hpp>
+#include <utils/SourceGenerator.hpp>
+
+// counts every heap allocation of the process
+// such that the number of allocations per parse can be reported
+static std::atomic<std::size_t> heap_allocations{0};
+
+auto operator new(std::size_t size) -> void*
+{
+    heap_allocations.fetch_add(1, std::memory_order_relaxed);
+    if(auto* memory = std::malloc(size == 0 ? 1 : size)) {
+        return memory;
+    }
+    throw std::bad_alloc{};
+}
+
+auto operator delete(void* memory) noexcept -> void
+{
+    std::free(memory);
+}
+
+auto operator delete(void* memory, std::size_t /*unused*/) noexcept -> void
+{
+    std::free(memory);
+}
+
+// parses the whole source and destroys the resulting tree in every iteration
+static auto parse_block(benchmark::State& state, bool use_arena) -> void
+{
+    const auto source = benchmarks::generate_block_source(state.range(0));
+    std::size_t allocations = 0;
+
+    for(auto _ : state) {
+        const auto before = heap_allocations.load(std::memory_order_relaxed);
+
+        if(use_arena) {
+            ast::Arena arena;
+            auto result = parser::Parser{source, arena}.expression();
+            benchmark::DoNotOptimize(result);
+        } else {
+            auto result = parser::Parser{source}.expression();
+            benchmark::DoNotOptimize(result);
+        }
+
+        allocations += heap_allocations.load(std::memory_order_relaxed) - before;
+    }
+
+    const auto per_iteration = static_cast<double>(allocations) / static_cast<double>(state.iterations());
+
+    state.counters["allocations"] = per_iteration;
+    state.counters["allocations_per_1k_lines"] = per_iteration * 1000.0 / static_cast<double>(state.range(0));
+    state.SetBytesProcessed(state.iterations() * source.size());
+}
+
+static auto BM_ParseHeap(benchmark::State& state) -> void
+{
+    parse_block(state, false);
+}
+BENCHMARK(BM_ParseHeap)->Arg(1000)->Arg(100000);
+
+static auto BM_ParseArena(benchmark::State& state) -> void
+{
+    parse_block(state, true);
+}
+BENCHMARK(BM_ParseArena)->Arg(1000)->Arg(100000);
+
+BENCHMARK_MAIN();
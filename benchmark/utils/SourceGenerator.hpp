@@ -0,0 +1,181 @@
+#pragma once
+
+#include <cstddef>
+#include <fmt/core.h>
+#include <string>
+
+namespace benchmarks {
+
+// generates neon source code similar to the machine generated sources we compile
+// every line is a let statement with a long identifier, some indentation and
+// a mix of literals, operators and calls
+inline auto generate_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    source.reserve(lines * 96);
+
+    for(std::size_t i = 0; i < lines; i++) {
+        source += fmt::format("    let generated_value_{}: Int = ", i);
+
+        switch(i % 4) {
+        case 0:
+            source += fmt::format("computeSomething(first_argument_{}, {}, 3.1415) + 42\n", i, i);
+            break;
+        case 1:
+            source += fmt::format("if(a_{} <= b) {{ => \"some string {}\" }} else {{ => self }}\n", i, i);
+            break;
+        case 2:
+            source += fmt::format("(x: Int, y) => x * y - {} // a trailing comment\n", i);
+            break;
+        default:
+            source += fmt::format("!flag_{} && other_flag || value.member != {}\n", i, i);
+            break;
+        }
+    }
+
+    return source;
+}
+
+// generates deeply indented lines with very long identifiers
+// which is what most of the lexing time of generated sources is spent on
+inline auto generate_long_identifier_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    source.reserve(lines * 160);
+
+    for(std::size_t i = 0; i < lines; i++) {
+        source += std::string(4 * (i % 8 + 1), ' ');
+        source += fmt::format("let generated_module_namespace_component_value_identifier_{} = "
+                              "other_generated_module_namespace_component_value_{} + 1234567890\n",
+                              i, i);
+    }
+
+    return source;
+}
+
+// generates lines with long string literals containing a few escapes
+inline auto generate_string_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    source.reserve(lines * 160);
+
+    for(std::size_t i = 0; i < lines; i++) {
+        source += fmt::format("let message_{} = \"generated message number {} which is rather long "
+                              "and contains \\\"quoted\\\" words as well as a \\n newline\"\n",
+                              i, i);
+    }
+
+    return source;
+}
+
+// generates one large block expression with a let statement per line
+// which the parser can parse as a whole, the block returns the last value
+inline auto generate_block_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    source.reserve(lines * 80 + 32);
+    source += "{";
+
+    for(std::size_t i = 0; i < lines; i++) {
+        source += fmt::format("let value_{} = ", i);
+
+        switch(i % 4) {
+        case 0:
+            source += fmt::format("computeSomething(argument_{}, {}, 3.1415) + 42\n", i, i);
+            break;
+        case 1:
+            source += fmt::format("if(a_{} <= b) {{ => \"some string\" }} else {{ => self }}\n", i);
+            break;
+        case 2:
+            source += fmt::format("(x, y) => x * y - {}\n", i);
+            break;
+        default:
+            source += fmt::format("!flag_{} && other_flag || value.member != {}\n", i, i);
+            break;
+        }
+    }
+
+    source += fmt::format("=> value_{}}}", lines == 0 ? 0 : lines - 1);
+    return source;
+}
+
+// generates a module with one top level let or function per element,
+// every fourth element is a function whose body is a block spanning multiple lines
+inline auto generate_module_source(std::size_t elements) -> std::string
+{
+    std::string source;
+    source.reserve(elements * 80);
+
+    for(std::size_t i = 0; i < elements; i++) {
+        switch(i % 4) {
+        case 0:
+            source += fmt::format("let value_{} = computeSomething(argument_{}, {}, 3.1415) + 42\n", i, i, i);
+            break;
+        case 1:
+            source += fmt::format("let value_{} = if(a_{} <= b) {{ => \"some string\" }} else {{ => self }}\n", i, i);
+            break;
+        case 2:
+            source += fmt::format("let value_{} = (x, y) => x * y - {}\n", i, i);
+            break;
+        default:
+            source += fmt::format("fun function_{}(flag: Bool, other_flag: Bool): Bool = "
+                                  "{{let x = flag\nlet y = !x && other_flag\n=> y || value.member != {}}}\n",
+                                  i, i);
+            break;
+        }
+    }
+
+    return source;
+}
+
+// generates lambdas nested depth times which all start with a parenthesized parameter list
+// ((a0, b) => ((a1, b) => ... x))
+inline auto generate_nested_lambda_source(std::size_t depth) -> std::string
+{
+    std::string source;
+    source.reserve(depth * 20);
+
+    for(std::size_t i = 0; i < depth; i++) {
+        source += fmt::format("((a{}, b) => ", i);
+    }
+    source += "x";
+    source += std::string(depth, ')');
+
+    return source;
+}
+
+// generates tuples nested depth times, every level starts like a lambda parameter list
+// (a, b, (a, b, ... x))
+inline auto generate_nested_tuple_source(std::size_t depth) -> std::string
+{
+    std::string source;
+    source.reserve(depth * 8);
+
+    for(std::size_t i = 0; i < depth; i++) {
+        source += "(a, b, ";
+    }
+    source += "x";
+    source += std::string(depth, ')');
+
+    return source;
+}
+
+// generates block expressions nested depth times
+// {let v = {let v = ... 1\n=> v}\n=> v}
+inline auto generate_nested_block_source(std::size_t depth) -> std::string
+{
+    std::string source;
+    source.reserve(depth * 16);
+
+    for(std::size_t i = 0; i < depth; i++) {
+        source += "{let v = ";
+    }
+    source += "1";
+    for(std::size_t i = 0; i < depth; i++) {
+        source += "\n=> v}";
+    }
+
+    return source;
+}
+
+} // namespace benchmarks
@@ -1,28 +1,125 @@
-#include <ast/Ast.hpp>
-#include <ast/expression/Integer.hpp>
-#include <ctre/ctre.hpp>
+#include <CLI/CLI.hpp>
+#include <algorithm>
+#include <chrono>
+#include <common/Diagnostic.hpp>
+#include <common/MappedFile.hpp>
+#include <cstddef>
 #include <fmt/core.h>
-#include <iostream>
-#include <lexer/Lexer.hpp>
-#include <parser/Parser.hpp>
+#include <lexer/LineIndex.hpp>
+#include <optional>
+#include <parser/ParallelParser.hpp>
+#include <string>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <thread>
+#include <vector>
 
-auto main(int argc, char *argv[]) -> int
+namespace {
+
+// what the front end did with a single source file
+struct FileReport
 {
-    static_assert(common::is_specialization_of<std::variant, std::variant<bool, int>>::value);
-    std::string s;
-    fmt::print("enter a token text\n");
-    std::getline(std::cin, s);
+    std::size_t bytes = 0;
+    std::size_t elements = 0;
+    std::chrono::duration<double> time{};
+    std::optional<std::string> error;
+};
 
-    lexing::Lexer l{s};
+auto megabytes_per_second(std::size_t bytes, std::chrono::duration<double> time) noexcept -> double
+{
+    return time.count() > 0.0
+        ? static_cast<double>(bytes) / (1024.0 * 1024.0) / time.count()
+        : 0.0;
+}
 
-    while(auto token = l.peek()) {
-        if(token.value().getType() == lexing::TokenTypes::END_OF_FILE) {
-            break;
-        }
+// maps, lexes and parses a single file
+// large files are split into segments which are parsed in parallel as well
+auto compile_file(const std::string& path) noexcept -> FileReport
+{
+    FileReport report;
+    const auto start = std::chrono::steady_clock::now();
+
+    auto file = common::MappedFile::open(path.c_str());
+    if(not file.has_value()) {
+        report.error = fmt::format("{}: unable to open: {}", path, file.error().message());
+        return report;
+    }
 
-        fmt::print("{}\n", lexing::get_description(token.value().getType()));
-        fmt::print("{}\n", token.value().getValue());
+    const auto content = file.value().content();
+    report.bytes = content.size();
 
-        l.pop();
+    auto module = parser::parse_parallel(content);
+    if(module.has_value()) {
+        report.elements = module.value().getElements().size();
+    } else {
+        // the line index is only built if there is an error to report
+        report.error = fmt::format("{}:{}",
+                                   path,
+                                   common::error::render(module.error(), lexing::LineIndex{content}));
     }
+
+    report.time = std::chrono::steady_clock::now() - start;
+    return report;
+}
+
+} // namespace
+
+auto main(int argc, char* argv[]) -> int
+{
+    CLI::App app{"neonc, the neon compiler"};
+
+    std::vector<std::string> files;
+    app.add_option("files", files, "the source files to compile")
+        ->required()
+        ->check(CLI::ExistingFile);
+
+    unsigned jobs = std::max(1u, std::thread::hardware_concurrency());
+    app.add_option("-j,--jobs", jobs, "the number of threads used to compile the files", true)
+        ->check(CLI::Range(1u, 1024u));
+
+    CLI11_PARSE(app, argc, argv);
+
+    std::vector<FileReport> reports(files.size());
+
+    // all files and the segments of large files share one arena limited to the given number of jobs
+    const auto start = std::chrono::steady_clock::now();
+
+    tbb::task_arena arena{static_cast<int>(jobs)};
+    arena.execute([&] {
+        tbb::parallel_for(std::size_t{0}, files.size(), [&](std::size_t i) {
+            reports[i] = compile_file(files[i]);
+        });
+    });
+
+    const std::chrono::duration<double> total_time = std::chrono::steady_clock::now() - start;
+
+    std::size_t total_bytes = 0;
+    std::size_t failed = 0;
+
+    for(std::size_t i = 0; i < files.size(); i++) {
+        const auto& report = reports[i];
+        total_bytes += report.bytes;
+
+        if(report.error.has_value()) {
+            failed++;
+            fmt::print(stderr, "{}\n", report.error.value());
+            continue;
+        }
+
+        fmt::print("{}: {} elements, {} bytes in {:.2f} ms ({:.1f} MB/s)\n",
+                   files[i],
+                   report.elements,
+                   report.bytes,
+                   report.time.count() * 1000.0,
+                   megabytes_per_second(report.bytes, report.time));
+    }
+
+    fmt::print("total: {} files, {} bytes in {:.2f} ms with {} jobs ({:.1f} MB/s)\n",
+               files.size(),
+               total_bytes,
+               total_time.count() * 1000.0,
+               jobs,
+               megabytes_per_second(total_bytes, total_time));
+
+    return failed == 0 ? 0 : 1;
 }
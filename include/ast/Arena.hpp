@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <memory>
+#include <new>
+#include <type_traits>
+#include <utility>
+#include <vector>
+
+namespace ast {
+
+// a bump allocator for ast nodes
+// nodes are placed one after another into large blocks, releasing the arena frees
+// all blocks at once instead of every node on its own. nodes which are not trivially
+// destructible (i.e. own a std::vector) register their destructor, these are run
+// in one flat loop without recursing through the tree.
+// all ast nodes created in an arena need to be dropped before the arena is destroyed
+class Arena
+{
+public:
+    constexpr static std::size_t initial_block_size = 64 * 1024;
+    constexpr static std::size_t max_block_size = 4 * 1024 * 1024;
+
+    Arena() noexcept = default;
+    Arena(Arena&& other) noexcept
+        : blocks_(std::move(other.blocks_)),
+          destructors_(std::move(other.destructors_)),
+          current_(std::exchange(other.current_, nullptr)),
+          remaining_(std::exchange(other.remaining_, 0)),
+          first_block_size_(std::exchange(other.first_block_size_, 0)),
+          allocation_count_(std::exchange(other.allocation_count_, 0)),
+          allocated_bytes_(std::exchange(other.allocated_bytes_, 0)) {}
+    auto operator=(Arena&& other) noexcept -> Arena&
+    {
+        if(this != &other) {
+            release();
+            blocks_ = std::move(other.blocks_);
+            destructors_ = std::move(other.destructors_);
+            current_ = std::exchange(other.current_, nullptr);
+            remaining_ = std::exchange(other.remaining_, 0);
+            first_block_size_ = std::exchange(other.first_block_size_, 0);
+            allocation_count_ = std::exchange(other.allocation_count_, 0);
+            allocated_bytes_ = std::exchange(other.allocated_bytes_, 0);
+        }
+        return *this;
+    }
+    Arena(const Arena&) = delete;
+    auto operator=(const Arena&) -> Arena& = delete;
+
+    ~Arena() noexcept
+    {
+        release();
+    }
+
+    template<class T, class... Args>
+    auto create(Args&&... args) noexcept -> T*
+    {
+        auto* memory = allocate(sizeof(T), alignof(T));
+        auto* object = ::new(memory) T(std::forward<Args>(args)...);
+
+        if constexpr(not std::is_trivially_destructible_v<T>) {
+            destructors_.emplace_back(Destructor{
+                [](void* obj) { static_cast<T*>(obj)->~T(); },
+                object});
+        }
+
+        return object;
+    }
+
+    auto allocate(std::size_t size, std::size_t alignment) noexcept -> void*
+    {
+        void* memory = current_;
+        if(current_ == nullptr or std::align(alignment, size, memory, remaining_) == nullptr) {
+            add_block(size + alignment);
+            memory = current_;
+            std::align(alignment, size, memory, remaining_);
+        }
+
+        current_ = static_cast<std::byte*>(memory) + size;
+        remaining_ -= size;
+        allocation_count_++;
+        allocated_bytes_ += size;
+
+        return memory;
+    }
+
+    // destroys all nodes of the arena and frees its memory
+    auto release() noexcept -> void
+    {
+        std::for_each(destructors_.rbegin(), destructors_.rend(), [](const auto& destructor) {
+            destructor.destroy(destructor.object);
+        });
+
+        destructors_.clear();
+        blocks_.clear();
+        current_ = nullptr;
+        remaining_ = 0;
+    }
+
+    // destroys all nodes of the arena but keeps its first block
+    // such that the arena can be reused without allocating again
+    auto reset() noexcept -> void
+    {
+        std::for_each(destructors_.rbegin(), destructors_.rend(), [](const auto& destructor) {
+            destructor.destroy(destructor.object);
+        });
+
+        destructors_.clear();
+        blocks_.resize(std::min(blocks_.size(), std::size_t{1}));
+        current_ = blocks_.empty() ? nullptr : blocks_.front().get();
+        remaining_ = blocks_.empty() ? 0 : first_block_size_;
+        allocation_count_ = 0;
+        allocated_bytes_ = 0;
+    }
+
+    // number of objects allocated from this arena since it was created or last reset
+    auto get_allocation_count() const noexcept -> std::size_t
+    {
+        return allocation_count_;
+    }
+
+    // bytes allocated from this arena since it was created or last reset
+    auto get_allocated_bytes() const noexcept -> std::size_t
+    {
+        return allocated_bytes_;
+    }
+
+    // number of blocks which were requested from the heap
+    auto get_block_count() const noexcept -> std::size_t
+    {
+        return blocks_.size();
+    }
+
+private:
+    struct Destructor
+    {
+        void (*destroy)(void*);
+        void* object;
+    };
+
+    auto add_block(std::size_t min_size) noexcept -> void
+    {
+        const auto growth = std::min(initial_block_size << blocks_.size(), max_block_size);
+        const auto size = std::max(growth, min_size);
+
+        if(blocks_.empty()) {
+            first_block_size_ = size;
+        }
+
+        blocks_.emplace_back(std::make_unique<std::byte[]>(size));
+        current_ = blocks_.back().get();
+        remaining_ = size;
+    }
+
+private:
+    std::vector<std::unique_ptr<std::byte[]>> blocks_;
+    std::vector<Destructor> destructors_;
+    std::byte* current_ = nullptr;
+    std::size_t remaining_ = 0;
+    std::size_t first_block_size_ = 0;
+    std::size_t allocation_count_ = 0;
+    std::size_t allocated_bytes_ = 0;
+};
+
+} // namespace ast
@@ -12,6 +12,7 @@
 #include <ast/import/DirectImport.hpp>
 #include <ast/type/NamedType.hpp>
 #include <ast/type/SelfType.hpp>
+#include <common/SmallVector.hpp>
 #include <common/Traits.hpp>
 
 namespace ast {
@@ -34,26 +35,8 @@ class LambdaExpr;
 class TupleExpr;
 class BlockExpr;
 class ForExpr;
-
-class Addition;
-class Substraction;
-class Multiplication;
-class Division;
-class Remainder;
-class LogicalOr;
-class LogicalAnd;
-class BitwiseOr;
-class BitwiseAnd;
-class LessThen;
-class LessEqThen;
-class GreaterThen;
-class GreaterEqThen;
-class Equal;
-class NotEqual;
-class UnaryMinus;
-class UnaryPlus;
-class LogicalNot;
-class MemberAccess;
+class BinaryOperation;
+class UnaryOperation;
 
 using Expression = std::variant<Identifier,
                                 Integer,
@@ -67,25 +50,8 @@ using Expression = std::variant<Identifier,
                                 Forward<TupleExpr>,
                                 Forward<BlockExpr>,
                                 Forward<ForExpr>,
-                                Forward<Addition>,
-                                Forward<Substraction>,
-                                Forward<Multiplication>,
-                                Forward<Division>,
-                                Forward<Remainder>,
-                                Forward<LogicalOr>,
-                                Forward<LogicalAnd>,
-                                Forward<BitwiseOr>,
-                                Forward<BitwiseAnd>,
-                                Forward<LessThen>,
-                                Forward<LessEqThen>,
-                                Forward<GreaterThen>,
-                                Forward<GreaterEqThen>,
-                                Forward<Equal>,
-                                Forward<NotEqual>,
-                                Forward<UnaryMinus>,
-                                Forward<UnaryPlus>,
-                                Forward<LogicalNot>,
-                                Forward<MemberAccess>>;
+                                Forward<BinaryOperation>,
+                                Forward<UnaryOperation>>;
 
 class TypeclassImport;
 using Import = std::variant<DirectImport,
@@ -104,6 +70,12 @@ using Statement = std::variant<Import,
                                Forward<IfStmt>,
                                Forward<ForStmt>>;
 
+// child lists of the ast nodes
+// most lists only have one or two elements which are stored inline without allocating
+using TypeList = common::SmallVector<Type, 2>;
+using ExpressionList = common::SmallVector<Expression, 2>;
+using StatementList = common::SmallVector<Statement, 2>;
+
 using FunctionStatement = std::variant<Expression,
                                        Import,
                                        Forward<LetAssignment>,
@@ -138,10 +110,14 @@ constexpr auto getTextArea(const T& ast_element) noexcept
     } else {
 
         return std::visit(
-            [](const auto& e) {
+            [](const auto& e) -> lexing::TextArea {
                 constexpr bool is_forward = common::is_specialization_of<Forward, std::decay_t<decltype(e)>>::value;
+                constexpr bool is_variant = common::is_specialization_of<std::variant, std::decay_t<decltype(e)>>::value;
 
-                if constexpr(is_forward) {
+                // nested variants like the imports of the top level elements
+                if constexpr(is_variant) {
+                    return getTextArea(e);
+                } else if constexpr(is_forward) {
                     return e->getArea();
                 } else {
                     return e.getArea();
@@ -169,8 +145,11 @@ constexpr auto setTextArea(T& ast_element, lexing::TextArea new_area) noexcept
         return std::visit(
             [&](auto& e) {
                 constexpr bool is_forward = common::is_specialization_of<Forward, std::decay_t<decltype(e)>>::value;
+                constexpr bool is_variant = common::is_specialization_of<std::variant, std::decay_t<decltype(e)>>::value;
 
-                if constexpr(is_forward) {
+                if constexpr(is_variant) {
+                    setTextArea(e, new_area);
+                } else if constexpr(is_forward) {
                     e->setArea(new_area);
                 } else {
                     e.setArea(new_area);
@@ -204,3 +183,8 @@ constexpr auto setTextArea(T& ast_element, lexing::TextArea new_area) noexcept
 #include <ast/statement/WhileStmt.hpp>
 
 #include <ast/import/TypeclassImport.hpp>
+
+#include <ast/toplevel/FunctionDefinition.hpp>
+#include <ast/toplevel/Namespace.hpp>
+#include <ast/toplevel/TypeDefinition.hpp>
+#include <ast/toplevel/TypeclassDefinition.hpp>
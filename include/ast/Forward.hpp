@@ -1,51 +1,94 @@
 #pragma once
 
+#include <ast/Arena.hpp>
+#include <cstdint>
 #include <memory>
 #include <utility>
 
 namespace ast {
 
+// tag to construct a Forward which points to a node owned by an Arena
+struct ArenaOwned
+{};
+
 // clang-format off
 template<class T>
 requires (!std::is_array_v<T>)
 // a custom std::unique_ptr like smart ptr which does not allow an empty state
+// the element is either owned by the Forward itself or by an Arena,
+// in the later case the Forward does not free it and the Arena releases it.
+// the owner is stored in the lowest bit of the pointer such that a Forward is
+// as large as a pointer, ast nodes are always aligned to more than one byte
 class Forward
 // clang-format on
 {
 public:
     using value_type = T;
     constexpr Forward() = delete;
-    constexpr Forward(Forward&&) noexcept = default;
     constexpr Forward(const Forward&) = delete;
-    constexpr auto operator=(Forward&&) noexcept -> Forward& = default;
     constexpr auto operator=(const Forward&) noexcept -> Forward& = delete;
 
     // clang-format off
-    constexpr Forward(T* t) noexcept : elem_(t) {}
-    constexpr Forward(T&& t) noexcept : elem_(std::make_unique<T>(std::move(t))) {}
+    constexpr Forward(T* t) noexcept : ptr_(to_bits(t)) {}
+    constexpr Forward(ArenaOwned /*unused*/, T* t) noexcept : ptr_(to_bits(t) | arena_bit) {}
+    constexpr Forward(T&& t) noexcept : ptr_(to_bits(new T(std::move(t)))) {}
     // clang-format on
 
+    constexpr Forward(Forward&& other) noexcept
+        : ptr_(std::exchange(other.ptr_, 0)) {}
+
+    constexpr auto operator=(Forward&& other) noexcept -> Forward&
+    {
+        if(this != &other) {
+            reset();
+            ptr_ = std::exchange(other.ptr_, 0);
+        }
+        return *this;
+    }
+
+    constexpr ~Forward() noexcept
+    {
+        reset();
+    }
+
     constexpr auto operator==(const Forward& rhs) const noexcept
     {
-        return *elem_ == *rhs.elem_;
+        return *get() == *rhs.get();
     }
 
     constexpr auto operator!=(const Forward& rhs) const noexcept
     {
-        return *elem_ != *rhs.elem_;
+        return *get() != *rhs.get();
     }
 
     // clang-format off
-    constexpr auto operator*() noexcept -> T& { return *elem_;}
-    constexpr auto operator*() const noexcept -> const T& { return *elem_;}
-    constexpr auto operator->() noexcept -> T* { return elem_.get();}
-    constexpr auto operator->() const noexcept -> const T* { return elem_.get();}
-    constexpr auto get() const noexcept -> const T* {return elem_.get();};
-    constexpr auto get() noexcept -> T* {return elem_.get();};
+    constexpr auto operator*() noexcept -> T& { return *get();}
+    constexpr auto operator*() const noexcept -> const T& { return *get();}
+    constexpr auto operator->() noexcept -> T* { return get();}
+    constexpr auto operator->() const noexcept -> const T* { return get();}
+    constexpr auto get() const noexcept -> const T* {return reinterpret_cast<const T*>(ptr_ & ~arena_bit);};
+    constexpr auto get() noexcept -> T* {return reinterpret_cast<T*>(ptr_ & ~arena_bit);};
+    constexpr auto is_arena_owned() const noexcept -> bool {return (ptr_ & arena_bit) != 0;};
     // clang-format on
 
 private:
-    std::unique_ptr<T> elem_;
+    constexpr static std::uintptr_t arena_bit = 1;
+
+    constexpr static auto to_bits(T* t) noexcept -> std::uintptr_t
+    {
+        static_assert(alignof(T) > arena_bit, "the lowest bit of the pointer stores the owner");
+        return reinterpret_cast<std::uintptr_t>(t);
+    }
+
+    constexpr auto reset() noexcept -> void
+    {
+        if(not is_arena_owned()) {
+            delete get();
+        }
+    }
+
+private:
+    std::uintptr_t ptr_;
 };
 
 // clang-format off
@@ -55,6 +98,18 @@ constexpr auto forward(Args&&... args)noexcept
 {
     return Forward<T>(new T(std::forward<Args>(args)...));
 }
+
+// allocates the node in the given arena, if there is no arena it is allocated on the heap
+template<class T, class... Args>
+requires (!std::is_array_v<T>)
+constexpr auto forward(Arena* arena, Args&&... args)noexcept
+{
+    if(arena == nullptr) {
+        return Forward<T>(new T(std::forward<Args>(args)...));
+    }
+
+    return Forward<T>(ArenaOwned{}, arena->create<T>(std::forward<Args>(args)...));
+}
 // clang-format on
 
 } // namespace ast
@@ -5,12 +5,14 @@
 
 namespace ast {
 
+// base of all ast nodes which stores their position in the source
+// nodes are never deleted through a pointer to AreaBase, therefore the destructor
+// is protected and not virtual such that nodes carry no vtable pointer
 class AreaBase
 {
 public:
     constexpr AreaBase(lexing::TextArea area) noexcept
         : area_(area) {}
-    constexpr virtual ~AreaBase() noexcept = default;
 
     [[nodiscard]] constexpr auto getArea() const noexcept -> lexing::TextArea
     {
@@ -22,6 +24,9 @@ public:
         area_ = std::move(area);
     }
 
+protected:
+    constexpr ~AreaBase() noexcept = default;
+
 private:
     lexing::TextArea area_;
 };
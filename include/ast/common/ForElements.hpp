@@ -49,6 +49,8 @@ private:
     Expression rhs_;
 };
 
+static_assert(sizeof(ForLetElement) <= 64);
+
 class ForMonadicElement : public AreaBase
 {
 public:
@@ -91,6 +93,8 @@ private:
     Expression rhs_;
 };
 
+static_assert(sizeof(ForMonadicElement) <= 64);
+
 using ForElement = std::variant<ForLetElement, ForMonadicElement>;
 
 } // namespace ast
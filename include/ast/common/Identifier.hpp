@@ -1,32 +1,65 @@
 #pragma once
 
 #include <ast/common/AreaBase.hpp>
+#include <common/Interner.hpp>
+#include <cstddef>
+#include <functional>
 #include <lexer/TextArea.hpp>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 #include <variant>
 
 namespace ast {
 
+// a name in the source, represented by its symbol in an interner
+// comparing and hashing identifiers therefore never touches their text.
+// the global interner is used unless another one is given, the text of an identifier
+// can only be looked up in the interner it was created with, which has to be passed explicitly
 class Identifier : public AreaBase
 {
 public:
-    constexpr Identifier(lexing::TextArea area, std::string_view value) noexcept
-        : AreaBase{std::move(area)}, value_(value) {}
+    Identifier(lexing::TextArea area, std::string_view value) noexcept
+        : Identifier{area, value, common::Interner::global()} {}
+
+    Identifier(lexing::TextArea area, std::string_view value, common::Interner& interner) noexcept
+        : AreaBase{std::move(area)},
+          symbol_(interner.intern(value)) {}
+
+    constexpr Identifier(lexing::TextArea area, common::Symbol symbol) noexcept
+        : AreaBase{std::move(area)}, symbol_(symbol) {}
 
     constexpr auto operator==(const Identifier& other) const noexcept
         -> bool
     {
-        return value_ == other.value_;
+        return symbol_ == other.symbol_;
+    }
+
+    constexpr auto getSymbol() const noexcept -> common::Symbol
+    {
+        return symbol_;
     }
 
-    constexpr auto getValue() const noexcept -> std::string_view
+    // interner needs to be the one the identifier was created with
+    auto getValue(const common::Interner& interner) const noexcept -> std::string_view
     {
-        return value_;
+        return interner.lookup(symbol_);
     }
 
 private:
-    std::string_view value_;
+    common::Symbol symbol_;
 };
 
+static_assert(std::is_trivially_copyable_v<Identifier>);
+static_assert(sizeof(Identifier) <= 12);
+
 } // namespace ast
+
+template<>
+struct std::hash<ast::Identifier>
+{
+    constexpr auto operator()(const ast::Identifier& identifier) const noexcept -> std::size_t
+    {
+        return std::hash<common::Symbol>{}(identifier.getSymbol());
+    }
+};
@@ -2,26 +2,59 @@
 
 #include <ast/Ast.hpp>
 #include <ast/common/AreaBase.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <lexer/TextArea.hpp>
 #include <memory>
 
 namespace ast {
 
+enum class BinaryOperator : std::uint8_t {
+    ADDITION,
+    SUBSTRACTION,
+    MULTIPLICATION,
+    DIVISION,
+    REMAINDER,
+    LOGICAL_OR,
+    LOGICAL_AND,
+    BITWISE_OR,
+    BITWISE_AND,
+    LESS_THEN,
+    LESS_EQ_THEN,
+    GREATER_THEN,
+    GREATER_EQ_THEN,
+    EQUAL,
+    NOT_EQUAL,
+    MEMBER_ACCESS,
+};
+
+// number of binary operators, can be used to size lookup tables indexed by the operator
+constexpr std::size_t binary_operator_count = static_cast<std::size_t>(BinaryOperator::MEMBER_ACCESS) + 1;
+
 class BinaryOperation : public AreaBase
 {
 public:
-    constexpr BinaryOperation(lexing::TextArea area, Expression&& lhs, Expression&& rhs) noexcept
+    constexpr BinaryOperation(lexing::TextArea area, BinaryOperator op, Expression&& lhs, Expression&& rhs) noexcept
         : AreaBase(area),
           lhs_(std::move(lhs)),
-          rhs_(std::move(rhs)) {}
+          rhs_(std::move(rhs)),
+          op_(op) {}
 
     constexpr BinaryOperation() noexcept = delete;
     constexpr BinaryOperation(BinaryOperation&&) noexcept = default;
     constexpr BinaryOperation(const BinaryOperation&) noexcept = delete;
     constexpr auto operator=(BinaryOperation&&) noexcept -> BinaryOperation& = default;
     constexpr auto operator=(const BinaryOperation&) noexcept -> BinaryOperation& = delete;
-    // pure virtual destructor which makes it impossible to instantiate an object
-    constexpr virtual ~BinaryOperation() noexcept = 0;
+
+    constexpr auto operator==(const BinaryOperation& other) const noexcept -> bool
+    {
+        return op_ == other.op_ and lhs_ == other.lhs_ and rhs_ == other.rhs_;
+    }
+
+    constexpr auto getOperator() const noexcept -> BinaryOperator
+    {
+        return op_;
+    }
 
     constexpr auto getLeftHandSide() const noexcept -> const Expression&
     {
@@ -41,133 +74,12 @@ public:
         return rhs_;
     }
 
-    template<typename T>
-        requires std::is_base_of_v<BinaryOperation, T>
-    friend constexpr auto operator==(const T& lhs, const T& rhs) noexcept
-    {
-        return lhs.lhs_ == rhs.lhs_ and lhs.rhs_ == rhs.rhs_;
-    }
-
 private:
     Expression lhs_;
     Expression rhs_;
+    BinaryOperator op_;
 };
 
-constexpr BinaryOperation::~BinaryOperation() noexcept = default;
-
-
-
-
-class Addition : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class BitwiseAnd : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class BitwiseOr : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class Division : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class Equal : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class GreaterEqThen : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class GreaterThen : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class LessEqThen : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class LessThen : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class LogicalAnd : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class LogicalOr : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class MemberAccess : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class Multiplication : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class NotEqual : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class Remainder : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
-
-class Substraction : public ast::BinaryOperation
-{
-public:
-    using BinaryOperation::BinaryOperation;
-    using BinaryOperation::operator=;
-};
+static_assert(sizeof(BinaryOperation) <= 80);
 
 } // namespace ast
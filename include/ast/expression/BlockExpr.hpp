@@ -3,7 +3,6 @@
 
 #include <ast/Ast.hpp>
 #include <memory>
-#include <vector>
 
 namespace ast {
 
@@ -11,7 +10,7 @@ class BlockExpr : public AreaBase
 {
 public:
     constexpr BlockExpr(lexing::TextArea area,
-                        std::vector<Statement>&& body,
+                        StatementList&& body,
                         Expression&& ret_expr) noexcept
         : AreaBase(area),
           body_(std::move(body)),
@@ -28,11 +27,11 @@ public:
         return body_ == other.body_ and ret_expr_ == other.ret_expr_;
     }
 
-    constexpr auto getBody() const noexcept -> const std::vector<Statement>&
+    constexpr auto getBody() const noexcept -> const StatementList&
     {
         return body_;
     }
-    constexpr auto getBody() noexcept -> std::vector<Statement>&
+    constexpr auto getBody() noexcept -> StatementList&
     {
         return body_;
     }
@@ -47,8 +46,10 @@ public:
     }
 
 private:
-    std::vector<Statement> body_;
+    StatementList body_;
     Expression ret_expr_;
 };
 
+static_assert(sizeof(BlockExpr) <= 216);
+
 } // namespace ast
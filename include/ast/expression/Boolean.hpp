@@ -3,6 +3,7 @@
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
 #include <string_view>
+#include <type_traits>
 
 namespace ast {
 
@@ -27,4 +28,7 @@ private:
     bool value_;
 };
 
+static_assert(std::is_trivially_copyable_v<Boolean>);
+static_assert(sizeof(Boolean) <= 12);
+
 } // namespace ast
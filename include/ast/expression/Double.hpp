@@ -3,6 +3,7 @@
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
 #include <string_view>
+#include <type_traits>
 #include <utility>
 
 namespace ast {
@@ -33,4 +34,7 @@ private:
     double value_;
 };
 
+static_assert(std::is_trivially_copyable_v<Double>);
+static_assert(sizeof(Double) <= 16);
+
 } // namespace ast
@@ -51,4 +51,6 @@ private:
     Expression ret_expr_;
 };
 
+static_assert(sizeof(ForExpr) <= 64);
+
 } // namespace ast
@@ -5,7 +5,6 @@
 #include <lexer/TextArea.hpp>
 #include <memory>
 #include <string_view>
-#include <vector>
 
 namespace ast {
 
@@ -14,7 +13,7 @@ class FunctionCall : public AreaBase
 public:
     constexpr FunctionCall(lexing::TextArea area,
                            Expression&& caller,
-                           std::vector<Expression>&& arguments) noexcept
+                           ExpressionList&& arguments) noexcept
         : AreaBase{std::move(area)},
           caller_(std::move(caller)),
           arguments_(std::move(arguments)) {}
@@ -40,18 +39,20 @@ public:
     }
 
     constexpr auto getArguments() const noexcept
-        -> const std::vector<Expression>&
+        -> const ExpressionList&
     {
         return arguments_;
     }
-    constexpr auto getArguments() noexcept -> std::vector<Expression>&
+    constexpr auto getArguments() noexcept -> ExpressionList&
     {
         return arguments_;
     }
 
 private:
     Expression caller_;
-    std::vector<Expression> arguments_;
+    ExpressionList arguments_;
 };
 
+static_assert(sizeof(FunctionCall) <= 120);
+
 } // namespace ast
@@ -54,6 +54,8 @@ private:
     Expression block_;
 };
 
+static_assert(sizeof(ElifExpr) <= 72);
+
 class IfExpr : public AreaBase
 {
 public:
@@ -127,4 +129,6 @@ private:
     Expression else_body_;
 };
 
+static_assert(sizeof(IfExpr) <= 128);
+
 } // namespace ast
@@ -2,6 +2,7 @@
 
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace ast {
@@ -27,4 +28,7 @@ private:
     std::int64_t value_;
 };
 
+static_assert(std::is_trivially_copyable_v<Integer>);
+static_assert(sizeof(Integer) <= 16);
+
 } // namespace ast
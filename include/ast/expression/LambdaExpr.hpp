@@ -62,11 +62,15 @@ private:
     std::optional<Type> type_;
 };
 
+static_assert(sizeof(LambdaParameter) <= 104);
+
+using LambdaParameterList = common::SmallVector<LambdaParameter, 2>;
+
 class LambdaExpr : public AreaBase
 {
 public:
     constexpr LambdaExpr(lexing::TextArea area,
-                         std::vector<LambdaParameter>&& parameters,
+                         LambdaParameterList&& parameters,
                          Type&& ret_type,
                          Expression&& ret_expr) noexcept
         : AreaBase(area),
@@ -75,7 +79,7 @@ public:
           ret_expr_(std::move(ret_expr)) {}
 
     constexpr LambdaExpr(lexing::TextArea area,
-                         std::vector<LambdaParameter>&& parameters,
+                         LambdaParameterList&& parameters,
                          Expression&& ret_expr) noexcept
         : AreaBase(area),
           parameters_(std::move(parameters)),
@@ -95,11 +99,11 @@ public:
             and ret_expr_ == other.ret_expr_;
     }
 
-    constexpr auto getParameters() const noexcept -> const std::vector<LambdaParameter>&
+    constexpr auto getParameters() const noexcept -> const LambdaParameterList&
     {
         return parameters_;
     }
-    constexpr auto getParameters() noexcept -> std::vector<LambdaParameter>&
+    constexpr auto getParameters() noexcept -> LambdaParameterList&
     {
         return parameters_;
     }
@@ -128,9 +132,11 @@ public:
     }
 
 private:
-    std::vector<LambdaParameter> parameters_;
+    LambdaParameterList parameters_;
     std::optional<Type> ret_type_;
     Expression ret_expr_;
 };
 
+static_assert(sizeof(LambdaExpr) <= 296);
+
 } // namespace ast
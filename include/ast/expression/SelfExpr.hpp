@@ -1,6 +1,7 @@
 #pragma once
 
 #include <ast/common/AreaBase.hpp>
+#include <type_traits>
 #include <utility>
 
 namespace ast {
@@ -29,4 +30,7 @@ public:
     }
 };
 
+static_assert(std::is_trivially_copyable_v<SelfExpr>);
+static_assert(sizeof(SelfExpr) <= 8);
+
 } // namespace ast
@@ -3,6 +3,7 @@
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
 #include <string_view>
+#include <type_traits>
 
 namespace ast {
 
@@ -27,4 +28,7 @@ private:
     std::string_view value_;
 };
 
+static_assert(std::is_trivially_copyable_v<String>);
+static_assert(sizeof(String) <= 24);
+
 } // namespace ast
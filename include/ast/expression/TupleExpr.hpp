@@ -37,4 +37,6 @@ private:
     std::vector<Expression> expressions_;
 };
 
+static_assert(sizeof(TupleExpr) <= 32);
+
 } // namespace ast
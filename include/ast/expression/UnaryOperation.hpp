@@ -1,23 +1,46 @@
+#pragma once
+
 #include <ast/Ast.hpp>
 #include <ast/common/AreaBase.hpp>
+#include <cstddef>
+#include <cstdint>
 #include <lexer/TextArea.hpp>
 #include <memory>
 
 namespace ast {
 
+enum class UnaryOperator : std::uint8_t {
+    PLUS,
+    MINUS,
+    LOGICAL_NOT,
+};
+
+// number of unary operators, can be used to size lookup tables indexed by the operator
+constexpr std::size_t unary_operator_count = static_cast<std::size_t>(UnaryOperator::LOGICAL_NOT) + 1;
+
 class UnaryOperation : public AreaBase
 {
 public:
-    constexpr UnaryOperation(lexing::TextArea area, Expression&& rhs) noexcept
+    constexpr UnaryOperation(lexing::TextArea area, UnaryOperator op, Expression&& rhs) noexcept
         : AreaBase(area),
-          rhs_(std::move(rhs)) {}
+          rhs_(std::move(rhs)),
+          op_(op) {}
 
     constexpr UnaryOperation() noexcept = delete;
     constexpr UnaryOperation(UnaryOperation&&) noexcept = default;
     constexpr UnaryOperation(const UnaryOperation&) noexcept = delete;
     constexpr auto operator=(UnaryOperation&&) noexcept -> UnaryOperation& = default;
     constexpr auto operator=(const UnaryOperation&) noexcept -> UnaryOperation& = delete;
-    constexpr virtual ~UnaryOperation() noexcept = 0;
+
+    constexpr auto operator==(const UnaryOperation& other) const noexcept -> bool
+    {
+        return op_ == other.op_ and rhs_ == other.rhs_;
+    }
+
+    constexpr auto getOperator() const noexcept -> UnaryOperator
+    {
+        return op_;
+    }
 
     constexpr auto getRightHandSide() const noexcept -> const Expression&
     {
@@ -28,35 +51,11 @@ public:
         return rhs_;
     }
 
-    template<typename T>
-        requires std::is_base_of_v<UnaryOperation, T>
-    friend constexpr auto operator==(const T& lhs, const T& rhs) noexcept
-    {
-        return lhs.rhs_ == rhs.rhs_;
-    }
-
 private:
     Expression rhs_;
+    UnaryOperator op_;
 };
 
-constexpr UnaryOperation::~UnaryOperation() noexcept = default;
-
-class UnaryPlus : public UnaryOperation
-{
-    using UnaryOperation::UnaryOperation;
-    using UnaryOperation::operator=;
-};
-
-class UnaryMinus : public UnaryOperation
-{
-    using UnaryOperation::UnaryOperation;
-    using UnaryOperation::operator=;
-};
-
-class LogicalNot : public UnaryOperation
-{
-    using UnaryOperation::UnaryOperation;
-    using UnaryOperation::operator=;
-};
+static_assert(sizeof(UnaryOperation) <= 48);
 
 } // namespace ast
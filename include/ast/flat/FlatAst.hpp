@@ -0,0 +1,436 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <ast/flat/Node.hpp>
+#include <bit>
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <lexer/TextArea.hpp>
+#include <optional>
+#include <span>
+#include <string_view>
+#include <type_traits>
+#include <vector>
+
+namespace ast::flat {
+
+// an ast stored in flat arrays instead of a tree of heap allocated nodes.
+// a node is a 32 bit index into the side arrays of kinds, areas and payloads.
+// depending on its kind the payload is either a value or an index into the pool
+// of records of that shape (see NodeKind). children of a node are stored
+// contiguously in the children array, which makes walking the ast a linear
+// scan over a few arrays and allows to serialize it by dumping them
+class FlatAst
+{
+public:
+    constexpr FlatAst() noexcept = default;
+
+    auto add_leaf(NodeKind kind, lexing::TextArea area, std::uint32_t payload = 0) noexcept -> NodeId
+    {
+        kinds_.emplace_back(kind);
+        areas_.emplace_back(area);
+        payloads_.emplace_back(payload);
+        return static_cast<NodeId>(kinds_.size() - 1);
+    }
+
+    auto add_text(NodeKind kind, lexing::TextArea area, std::string_view text) noexcept -> NodeId
+    {
+        texts_.emplace_back(TextRef{static_cast<std::uint32_t>(chars_.size()),
+                                    static_cast<std::uint32_t>(text.size())});
+        chars_.insert(chars_.end(), text.begin(), text.end());
+        return add_leaf(kind, area, static_cast<std::uint32_t>(texts_.size() - 1));
+    }
+
+    auto add_integer(lexing::TextArea area, std::int64_t value) noexcept -> NodeId
+    {
+        integers_.emplace_back(value);
+        return add_leaf(NodeKind::INTEGER, area, static_cast<std::uint32_t>(integers_.size() - 1));
+    }
+
+    auto add_double(lexing::TextArea area, double value) noexcept -> NodeId
+    {
+        doubles_.emplace_back(value);
+        return add_leaf(NodeKind::DOUBLE, area, static_cast<std::uint32_t>(doubles_.size() - 1));
+    }
+
+    auto add_pair(NodeKind kind, lexing::TextArea area, NodeId first, NodeId second) noexcept -> NodeId
+    {
+        pairs_.emplace_back(Pair{first, second});
+        return add_leaf(kind, area, static_cast<std::uint32_t>(pairs_.size() - 1));
+    }
+
+    auto add_list(NodeKind kind, lexing::TextArea area, std::span<const NodeId> children) noexcept -> NodeId
+    {
+        lists_.emplace_back(add_children(children));
+        return add_leaf(kind, area, static_cast<std::uint32_t>(lists_.size() - 1));
+    }
+
+    auto add_composite(NodeKind kind,
+                       lexing::TextArea area,
+                       std::span<const NodeId> list,
+                       NodeId first,
+                       NodeId second = invalid_node,
+                       NodeId third = invalid_node) noexcept -> NodeId
+    {
+        composites_.emplace_back(Composite{add_children(list), first, second, third});
+        return add_leaf(kind, area, static_cast<std::uint32_t>(composites_.size() - 1));
+    }
+
+    auto get_node_count() const noexcept -> std::size_t
+    {
+        return kinds_.size();
+    }
+
+    auto get_kind(NodeId node) const noexcept -> NodeKind
+    {
+        return kinds_[node];
+    }
+
+    auto get_area(NodeId node) const noexcept -> lexing::TextArea
+    {
+        return areas_[node];
+    }
+
+    auto get_kinds() const noexcept -> std::span<const NodeKind>
+    {
+        return kinds_;
+    }
+
+    // only valid for IDENTIFIER and STRING nodes
+    auto get_text(NodeId node) const noexcept -> std::string_view
+    {
+        const auto ref = texts_[payloads_[node]];
+        return std::string_view{chars_.data() + ref.begin, ref.length};
+    }
+
+    auto get_integer(NodeId node) const noexcept -> std::int64_t
+    {
+        return integers_[payloads_[node]];
+    }
+
+    auto get_double(NodeId node) const noexcept -> double
+    {
+        return doubles_[payloads_[node]];
+    }
+
+    auto get_boolean(NodeId node) const noexcept -> bool
+    {
+        return payloads_[node] != 0;
+    }
+
+    // only valid for unary operations and OPTIONAL_TYPE nodes
+    auto get_operand(NodeId node) const noexcept -> NodeId
+    {
+        return payloads_[node];
+    }
+
+    auto get_pair(NodeId node) const noexcept -> const Pair&
+    {
+        return pairs_[payloads_[node]];
+    }
+
+    auto get_list(NodeId node) const noexcept -> std::span<const NodeId>
+    {
+        return get_children(lists_[payloads_[node]]);
+    }
+
+    auto get_composite(NodeId node) const noexcept -> const Composite&
+    {
+        return composites_[payloads_[node]];
+    }
+
+    auto get_children(NodeRange range) const noexcept -> std::span<const NodeId>
+    {
+        return std::span<const NodeId>{children_}.subspan(range.begin, range.count);
+    }
+
+    // dumps all arrays into one byte buffer which can be read back by deserialize
+    auto serialize() const noexcept -> std::vector<std::byte>
+    {
+        std::vector<std::byte> out;
+        write_value(out, magic);
+        write_value(out, version);
+        for_each_array(*this, [&](const auto& array) { write_array(out, array); });
+        return out;
+    }
+
+    // returns nothing if the data was not produced by serialize of the same version,
+    // or if it contains an unknown kind or an index or range outside of its pool
+    static auto deserialize(std::span<const std::byte> data) noexcept -> std::optional<FlatAst>
+    {
+        FlatAst ast;
+
+        if(read_value<std::uint32_t>(data) != magic or read_value<std::uint32_t>(data) != version) {
+            return std::nullopt;
+        }
+
+        bool ok = true;
+        for_each_array(ast, [&](auto& array) { ok = ok and read_array(data, array); });
+
+        if(not ok or not data.empty() or not ast.is_valid()) {
+            return std::nullopt;
+        }
+
+        return ast;
+    }
+
+    auto operator==(const FlatAst& other) const noexcept -> bool = default;
+
+private:
+    constexpr static std::uint32_t magic = 0x4e454f4e; // "NEON"
+    constexpr static std::uint32_t version = 1;
+
+    auto add_children(std::span<const NodeId> children) noexcept -> NodeRange
+    {
+        NodeRange range{static_cast<std::uint32_t>(children_.size()),
+                        static_cast<std::uint32_t>(children.size())};
+        children_.insert(children_.end(), children.begin(), children.end());
+        return range;
+    }
+
+    // how a node uses a child slot of its pair or composite
+    enum class Slot : std::uint8_t {
+        UNUSED,         // always invalid_node
+        CHILD,          // a node
+        OPTIONAL_CHILD, // a node or invalid_node
+    };
+
+    // checks that every node has a known kind whose payload is inside of its pool.
+    // the flattener adds children before their parents, therefore every child id has
+    // to be lower than the id of its parent which also rules out cycles.
+    // invalid_node is only allowed in the slots documented as optional in NodeKind
+    auto is_valid() const noexcept -> bool
+    {
+        const auto node_count = kinds_.size();
+        if(areas_.size() != node_count or payloads_.size() != node_count) {
+            return false;
+        }
+
+        for(std::size_t node = 0; node < node_count; node++) {
+            if(not is_valid_node(static_cast<NodeId>(node))) {
+                return false;
+            }
+        }
+
+        return std::ranges::all_of(texts_, [&](TextRef text) {
+            return std::uint64_t{text.begin} + text.length <= chars_.size();
+        });
+    }
+
+    // checks the payload and the children of node against the layout of its kind in NodeKind
+    auto is_valid_node(NodeId node) const noexcept -> bool
+    {
+        const auto payload = payloads_[node];
+
+        switch(kinds_[node]) {
+        case NodeKind::IDENTIFIER:
+        case NodeKind::STRING:
+            return payload < texts_.size();
+
+        case NodeKind::INTEGER:
+            return payload < integers_.size();
+
+        case NodeKind::DOUBLE:
+            return payload < doubles_.size();
+
+        case NodeKind::BOOLEAN:
+            return payload <= 1;
+
+        case NodeKind::SELF_EXPR:
+        case NodeKind::SELF_TYPE:
+            return payload == 0;
+
+        case NodeKind::UNARY_MINUS:
+        case NodeKind::UNARY_PLUS:
+        case NodeKind::LOGICAL_NOT:
+        case NodeKind::OPTIONAL_TYPE:
+            return is_valid_child(node, payload, Slot::CHILD);
+
+        case NodeKind::ELIF_EXPR:
+        case NodeKind::FOR_LET_ELEMENT:
+        case NodeKind::FOR_MONADIC_ELEMENT:
+        case NodeKind::ADDITION:
+        case NodeKind::SUBSTRACTION:
+        case NodeKind::MULTIPLICATION:
+        case NodeKind::DIVISION:
+        case NodeKind::REMAINDER:
+        case NodeKind::LOGICAL_OR:
+        case NodeKind::LOGICAL_AND:
+        case NodeKind::BITWISE_OR:
+        case NodeKind::BITWISE_AND:
+        case NodeKind::LESS_THEN:
+        case NodeKind::LESS_EQ_THEN:
+        case NodeKind::GREATER_THEN:
+        case NodeKind::GREATER_EQ_THEN:
+        case NodeKind::EQUAL:
+        case NodeKind::NOT_EQUAL:
+        case NodeKind::MEMBER_ACCESS:
+        case NodeKind::WHILE_STMT:
+        case NodeKind::ELIF_STMT:
+            return is_valid_pair(node, Slot::CHILD, Slot::CHILD);
+
+        case NodeKind::LAMBDA_PARAMETER:
+            return is_valid_pair(node, Slot::CHILD, Slot::OPTIONAL_CHILD);
+
+        case NodeKind::TUPLE_EXPR:
+        case NodeKind::UNION_TYPE:
+        case NodeKind::TUPLE_TYPE:
+        case NodeKind::ELSE_STMT:
+        case NodeKind::STATEMENT_LIST:
+            return payload < lists_.size() and is_valid_children(node, lists_[payload]);
+
+        case NodeKind::IF_EXPR:
+            return is_valid_composite(node, Slot::CHILD, Slot::CHILD, Slot::CHILD);
+
+        case NodeKind::IF_STMT:
+            return is_valid_composite(node, Slot::CHILD, Slot::CHILD, Slot::OPTIONAL_CHILD);
+
+        case NodeKind::LAMBDA_EXPR:
+            return is_valid_composite(node, Slot::OPTIONAL_CHILD, Slot::CHILD, Slot::UNUSED);
+
+        case NodeKind::TYPECLASS_IMPORT:
+            return is_valid_composite(node, Slot::CHILD, Slot::CHILD, Slot::UNUSED);
+
+        case NodeKind::FUNCTION_CALL:
+        case NodeKind::BLOCK_EXPR:
+        case NodeKind::FOR_EXPR:
+        case NodeKind::NAMED_TYPE:
+        case NodeKind::LAMBDA_TYPE:
+        case NodeKind::FOR_STMT:
+        case NodeKind::DIRECT_IMPORT:
+            return is_valid_composite(node, Slot::CHILD, Slot::UNUSED, Slot::UNUSED);
+
+        case NodeKind::LET_ASSIGNMENT:
+            return is_valid_composite(node, Slot::CHILD, Slot::OPTIONAL_CHILD, Slot::CHILD)
+                and composites_[payload].list.count == 0;
+        }
+
+        // kinds which are not part of NodeKind
+        return false;
+    }
+
+    auto is_valid_child(NodeId parent, NodeId child, Slot slot) const noexcept -> bool
+    {
+        switch(slot) {
+        case Slot::UNUSED:
+            return child == invalid_node;
+        case Slot::OPTIONAL_CHILD:
+            return child == invalid_node or child < parent;
+        case Slot::CHILD:
+            return child < parent;
+        }
+        return false;
+    }
+
+    auto is_valid_children(NodeId parent, NodeRange range) const noexcept -> bool
+    {
+        return std::uint64_t{range.begin} + range.count <= children_.size()
+            and std::ranges::all_of(get_children(range), [&](NodeId child) { return child < parent; });
+    }
+
+    auto is_valid_pair(NodeId node, Slot first, Slot second) const noexcept -> bool
+    {
+        const auto payload = payloads_[node];
+        return payload < pairs_.size()
+            and is_valid_child(node, pairs_[payload].first, first)
+            and is_valid_child(node, pairs_[payload].second, second);
+    }
+
+    auto is_valid_composite(NodeId node, Slot first, Slot second, Slot third) const noexcept -> bool
+    {
+        const auto payload = payloads_[node];
+        if(payload >= composites_.size()) {
+            return false;
+        }
+
+        const auto& composite = composites_[payload];
+        return is_valid_children(node, composite.list)
+            and is_valid_child(node, composite.first, first)
+            and is_valid_child(node, composite.second, second)
+            and is_valid_child(node, composite.third, third);
+    }
+
+    template<class Self, class Func>
+    static auto for_each_array(Self& self, Func&& func) noexcept -> void
+    {
+        func(self.kinds_);
+        func(self.areas_);
+        func(self.payloads_);
+        func(self.children_);
+        func(self.chars_);
+        func(self.texts_);
+        func(self.integers_);
+        func(self.doubles_);
+        func(self.pairs_);
+        func(self.lists_);
+        func(self.composites_);
+    }
+
+    template<class V>
+    static auto write_value(std::vector<std::byte>& out, const V& value) noexcept -> void
+    {
+        const auto* bytes = reinterpret_cast<const std::byte*>(&value);
+        out.insert(out.end(), bytes, bytes + sizeof(V));
+    }
+
+    template<class V>
+    static auto write_array(std::vector<std::byte>& out, const std::vector<V>& array) noexcept -> void
+    {
+        static_assert(std::is_trivially_copyable_v<V>);
+
+        write_value(out, static_cast<std::uint64_t>(array.size()));
+        const auto* bytes = reinterpret_cast<const std::byte*>(array.data());
+        out.insert(out.end(), bytes, bytes + array.size() * sizeof(V));
+    }
+
+    // returns nothing if there are not enough bytes left
+    template<class V>
+    static auto read_value(std::span<const std::byte>& data) noexcept -> std::optional<V>
+    {
+        if(data.size() < sizeof(V)) {
+            return std::nullopt;
+        }
+
+        std::array<std::byte, sizeof(V)> raw;
+        std::memcpy(raw.data(), data.data(), sizeof(V));
+        data = data.subspan(sizeof(V));
+        return std::bit_cast<V>(raw);
+    }
+
+    template<class V>
+    static auto read_array(std::span<const std::byte>& data, std::vector<V>& array) noexcept -> bool
+    {
+        const auto size = read_value<std::uint64_t>(data);
+        if(not size.has_value() or data.size() / sizeof(V) < size.value()) {
+            return false;
+        }
+
+        array.clear();
+        array.reserve(size.value());
+        for(std::uint64_t i = 0; i < size.value(); i++) {
+            array.emplace_back(read_value<V>(data).value());
+        }
+
+        return true;
+    }
+
+private:
+    // side arrays indexed by NodeId
+    std::vector<NodeKind> kinds_;
+    std::vector<lexing::TextArea> areas_;
+    std::vector<std::uint32_t> payloads_;
+
+    // pools indexed by the payload of a node
+    std::vector<NodeId> children_;
+    std::vector<char> chars_;
+    std::vector<TextRef> texts_;
+    std::vector<std::int64_t> integers_;
+    std::vector<double> doubles_;
+    std::vector<Pair> pairs_;
+    std::vector<NodeRange> lists_;
+    std::vector<Composite> composites_;
+};
+
+} // namespace ast::flat
@@ -0,0 +1,314 @@
+#pragma once
+
+#include <array>
+#include <ast/Ast.hpp>
+#include <ast/flat/FlatAst.hpp>
+#include <ast/flat/Node.hpp>
+#include <common/Interner.hpp>
+#include <optional>
+#include <span>
+#include <variant>
+#include <vector>
+
+namespace ast::flat {
+
+namespace detail {
+
+// node kinds of the binary and unary operators indexed by the operator
+constexpr std::array<NodeKind, binary_operator_count> binary_kinds{
+    NodeKind::ADDITION,
+    NodeKind::SUBSTRACTION,
+    NodeKind::MULTIPLICATION,
+    NodeKind::DIVISION,
+    NodeKind::REMAINDER,
+    NodeKind::LOGICAL_OR,
+    NodeKind::LOGICAL_AND,
+    NodeKind::BITWISE_OR,
+    NodeKind::BITWISE_AND,
+    NodeKind::LESS_THEN,
+    NodeKind::LESS_EQ_THEN,
+    NodeKind::GREATER_THEN,
+    NodeKind::GREATER_EQ_THEN,
+    NodeKind::EQUAL,
+    NodeKind::NOT_EQUAL,
+    NodeKind::MEMBER_ACCESS,
+};
+
+constexpr std::array<NodeKind, unary_operator_count> unary_kinds{
+    NodeKind::UNARY_PLUS,
+    NodeKind::UNARY_MINUS,
+    NodeKind::LOGICAL_NOT,
+};
+
+} // namespace detail
+
+// copies a tree of ast nodes into a FlatAst
+// children are added before their parents, so the root is always the last node.
+// the names of the identifiers are looked up in the interner the tree was parsed with
+class Flattener
+{
+public:
+    constexpr Flattener(FlatAst& ast, const common::Interner& interner) noexcept
+        : ast_(ast),
+          interner_(interner) {}
+
+    template<class... Ts>
+    auto add(const std::variant<Ts...>& node) noexcept -> NodeId
+    {
+        return std::visit([this](const auto& n) { return add(n); }, node);
+    }
+
+    template<class T>
+    auto add(const Forward<T>& node) noexcept -> NodeId
+    {
+        return add(*node);
+    }
+
+    template<class T>
+    auto add(const std::optional<T>& node) noexcept -> NodeId
+    {
+        return node.has_value() ? add(node.value()) : invalid_node;
+    }
+
+    auto add(const Identifier& node) noexcept -> NodeId
+    {
+        return ast_.add_text(NodeKind::IDENTIFIER, node.getArea(), node.getValue(interner_));
+    }
+
+    auto add(const Integer& node) noexcept -> NodeId
+    {
+        return ast_.add_integer(node.getArea(), node.getValue());
+    }
+
+    auto add(const Double& node) noexcept -> NodeId
+    {
+        return ast_.add_double(node.getArea(), node.getValue());
+    }
+
+    auto add(const Boolean& node) noexcept -> NodeId
+    {
+        return ast_.add_leaf(NodeKind::BOOLEAN, node.getArea(), node.getValue() ? 1 : 0);
+    }
+
+    auto add(const String& node) noexcept -> NodeId
+    {
+        return ast_.add_text(NodeKind::STRING, node.getArea(), node.getValue());
+    }
+
+    auto add(const SelfExpr& node) noexcept -> NodeId
+    {
+        return ast_.add_leaf(NodeKind::SELF_EXPR, node.getArea());
+    }
+
+    auto add(const IfExpr& node) noexcept -> NodeId
+    {
+        auto condition = add(node.getCondition());
+        auto body = add(node.getBody());
+        auto elifs = add_all(node.getElifs());
+        auto else_body = add(node.getElseBody());
+        return ast_.add_composite(NodeKind::IF_EXPR, node.getArea(), elifs, condition, body, else_body);
+    }
+
+    auto add(const ElifExpr& node) noexcept -> NodeId
+    {
+        auto condition = add(node.getCondition());
+        auto body = add(node.getBody());
+        return ast_.add_pair(NodeKind::ELIF_EXPR, node.getArea(), condition, body);
+    }
+
+    auto add(const FunctionCall& node) noexcept -> NodeId
+    {
+        auto caller = add(node.getCaller());
+        auto arguments = add_all(node.getArguments());
+        return ast_.add_composite(NodeKind::FUNCTION_CALL, node.getArea(), arguments, caller);
+    }
+
+    auto add(const LambdaExpr& node) noexcept -> NodeId
+    {
+        auto parameters = add_all(node.getParameters());
+        auto return_type = add(node.getReturnType());
+        auto body = add(node.getReturnExpr());
+        return ast_.add_composite(NodeKind::LAMBDA_EXPR, node.getArea(), parameters, return_type, body);
+    }
+
+    auto add(const LambdaParameter& node) noexcept -> NodeId
+    {
+        auto name = add(node.getName());
+        auto type = add(node.getType());
+        return ast_.add_pair(NodeKind::LAMBDA_PARAMETER, node.getArea(), name, type);
+    }
+
+    auto add(const TupleExpr& node) noexcept -> NodeId
+    {
+        return ast_.add_list(NodeKind::TUPLE_EXPR, node.getArea(), add_all(node.getExpressions()));
+    }
+
+    auto add(const BlockExpr& node) noexcept -> NodeId
+    {
+        auto body = add_all(node.getBody());
+        auto result = add(node.getReturnExpression());
+        return ast_.add_composite(NodeKind::BLOCK_EXPR, node.getArea(), body, result);
+    }
+
+    auto add(const ForExpr& node) noexcept -> NodeId
+    {
+        auto elements = add_all(node.getElements());
+        auto result = add(node.getReturnExpression());
+        return ast_.add_composite(NodeKind::FOR_EXPR, node.getArea(), elements, result);
+    }
+
+    auto add(const ForLetElement& node) noexcept -> NodeId
+    {
+        auto name = add(node.getName());
+        auto rhs = add(node.getRightHandSide());
+        return ast_.add_pair(NodeKind::FOR_LET_ELEMENT, node.getArea(), name, rhs);
+    }
+
+    auto add(const ForMonadicElement& node) noexcept -> NodeId
+    {
+        auto name = add(node.getName());
+        auto rhs = add(node.getRightHandSide());
+        return ast_.add_pair(NodeKind::FOR_MONADIC_ELEMENT, node.getArea(), name, rhs);
+    }
+
+    auto add(const BinaryOperation& node) noexcept -> NodeId
+    {
+        auto lhs = add(node.getLeftHandSide());
+        auto rhs = add(node.getRightHandSide());
+        auto kind = detail::binary_kinds[static_cast<std::size_t>(node.getOperator())];
+        return ast_.add_pair(kind, node.getArea(), lhs, rhs);
+    }
+
+    auto add(const UnaryOperation& node) noexcept -> NodeId
+    {
+        auto operand = add(node.getRightHandSide());
+        auto kind = detail::unary_kinds[static_cast<std::size_t>(node.getOperator())];
+        return ast_.add_leaf(kind, node.getArea(), operand);
+    }
+
+    auto add(const NamedType& node) noexcept -> NodeId
+    {
+        auto namespce = add_all(node.getNamespace());
+        auto name = add(node.getName());
+        return ast_.add_composite(NodeKind::NAMED_TYPE, node.getArea(), namespce, name);
+    }
+
+    auto add(const SelfType& node) noexcept -> NodeId
+    {
+        return ast_.add_leaf(NodeKind::SELF_TYPE, node.getArea());
+    }
+
+    auto add(const UnionType& node) noexcept -> NodeId
+    {
+        return ast_.add_list(NodeKind::UNION_TYPE, node.getArea(), add_all(node.getTypes()));
+    }
+
+    auto add(const TupleType& node) noexcept -> NodeId
+    {
+        return ast_.add_list(NodeKind::TUPLE_TYPE, node.getArea(), add_all(node.getTypes()));
+    }
+
+    auto add(const OptionalType& node) noexcept -> NodeId
+    {
+        auto type = add(node.getType());
+        return ast_.add_leaf(NodeKind::OPTIONAL_TYPE, node.getArea(), type);
+    }
+
+    auto add(const LambdaType& node) noexcept -> NodeId
+    {
+        auto arguments = add_all(node.getArguments());
+        auto return_type = add(node.getReturnType());
+        return ast_.add_composite(NodeKind::LAMBDA_TYPE, node.getArea(), arguments, return_type);
+    }
+
+    auto add(const LetAssignment& node) noexcept -> NodeId
+    {
+        auto name = add(node.getName());
+        auto type = add(node.getType());
+        auto rhs = add(node.getRightHandSide());
+        return ast_.add_composite(NodeKind::LET_ASSIGNMENT, node.getArea(), {}, name, type, rhs);
+    }
+
+    auto add(const WhileStmt& node) noexcept -> NodeId
+    {
+        auto condition = add(node.getCondition());
+        auto body = add_statements(node.getArea(), node.getBody());
+        return ast_.add_pair(NodeKind::WHILE_STMT, node.getArea(), condition, body);
+    }
+
+    auto add(const IfStmt& node) noexcept -> NodeId
+    {
+        auto condition = add(node.getCondition());
+        auto body = add_statements(node.getArea(), node.getBody());
+        auto elifs = add_all(node.getElifs());
+        auto else_body = add(node.getElse());
+        return ast_.add_composite(NodeKind::IF_STMT, node.getArea(), elifs, condition, body, else_body);
+    }
+
+    auto add(const ElifStmt& node) noexcept -> NodeId
+    {
+        auto condition = add(node.getCondition());
+        auto body = add_statements(node.getArea(), node.getBody());
+        return ast_.add_pair(NodeKind::ELIF_STMT, node.getArea(), condition, body);
+    }
+
+    auto add(const ElseStmt& node) noexcept -> NodeId
+    {
+        return ast_.add_list(NodeKind::ELSE_STMT, node.getArea(), add_all(node.getBody()));
+    }
+
+    auto add(const ForStmt& node) noexcept -> NodeId
+    {
+        auto elements = add_all(node.getElements());
+        auto body = add_statements(node.getArea(), node.getBody());
+        return ast_.add_composite(NodeKind::FOR_STMT, node.getArea(), elements, body);
+    }
+
+    auto add(const DirectImport& node) noexcept -> NodeId
+    {
+        auto namespce = add_all(node.getNamespace());
+        auto element = add(node.getImportedElement());
+        return ast_.add_composite(NodeKind::DIRECT_IMPORT, node.getArea(), namespce, element);
+    }
+
+    auto add(const TypeclassImport& node) noexcept -> NodeId
+    {
+        auto namespce = add_all(node.getNamespace());
+        auto typeclass = add(node.getTypeclass());
+        auto instance = add(node.getInstanceType());
+        return ast_.add_composite(NodeKind::TYPECLASS_IMPORT, node.getArea(), namespce, typeclass, instance);
+    }
+
+private:
+    // nodes is either a std::vector or a common::SmallVector of child nodes
+    template<class Nodes>
+    auto add_all(const Nodes& nodes) noexcept -> std::vector<NodeId>
+    {
+        std::vector<NodeId> ids;
+        ids.reserve(nodes.size());
+
+        for(const auto& node : nodes) {
+            ids.emplace_back(add(node));
+        }
+
+        return ids;
+    }
+
+    auto add_statements(lexing::TextArea area, std::span<const Statement> statements) noexcept -> NodeId
+    {
+        return ast_.add_list(NodeKind::STATEMENT_LIST, area, add_all(statements));
+    }
+
+private:
+    FlatAst& ast_;
+    const common::Interner& interner_;
+};
+
+// appends the given tree to ast and returns the id of its root
+template<class T>
+auto flatten(const T& node, FlatAst& ast, const common::Interner& interner) noexcept -> NodeId
+{
+    return Flattener{ast, interner}.add(node);
+}
+
+} // namespace ast::flat
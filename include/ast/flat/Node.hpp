@@ -0,0 +1,119 @@
+#pragma once
+
+#include <cstdint>
+#include <limits>
+#include <type_traits>
+
+namespace ast::flat {
+
+// the kind of a node in a FlatAst
+// the comment behind every kind names the pool its payload points into
+// and what the fields of the pooled record mean
+enum class NodeKind : std::uint8_t {
+    // expressions
+    IDENTIFIER,          // texts
+    INTEGER,             // integers
+    DOUBLE,              // doubles
+    BOOLEAN,             // the payload is the value itself
+    STRING,              // texts
+    SELF_EXPR,           // no payload
+    IF_EXPR,             // composites: elifs, condition, body, else body
+    ELIF_EXPR,           // pairs: condition, body
+    FUNCTION_CALL,       // composites: arguments, caller
+    LAMBDA_EXPR,         // composites: parameters, return type or invalid_node, body
+    LAMBDA_PARAMETER,    // pairs: name, type or invalid_node
+    TUPLE_EXPR,          // lists
+    BLOCK_EXPR,          // composites: statements, return expression
+    FOR_EXPR,            // composites: for elements, return expression
+    FOR_LET_ELEMENT,     // pairs: name, right hand side
+    FOR_MONADIC_ELEMENT, // pairs: name, right hand side
+    ADDITION,            // pairs: left hand side, right hand side
+    SUBSTRACTION,        // pairs
+    MULTIPLICATION,      // pairs
+    DIVISION,            // pairs
+    REMAINDER,           // pairs
+    LOGICAL_OR,          // pairs
+    LOGICAL_AND,         // pairs
+    BITWISE_OR,          // pairs
+    BITWISE_AND,         // pairs
+    LESS_THEN,           // pairs
+    LESS_EQ_THEN,        // pairs
+    GREATER_THEN,        // pairs
+    GREATER_EQ_THEN,     // pairs
+    EQUAL,               // pairs
+    NOT_EQUAL,           // pairs
+    MEMBER_ACCESS,       // pairs
+    UNARY_MINUS,         // the payload is the operand
+    UNARY_PLUS,          // the payload is the operand
+    LOGICAL_NOT,         // the payload is the operand
+
+    // types
+    NAMED_TYPE,    // composites: namespace, name
+    SELF_TYPE,     // no payload
+    UNION_TYPE,    // lists
+    TUPLE_TYPE,    // lists
+    OPTIONAL_TYPE, // the payload is the inner type
+    LAMBDA_TYPE,   // composites: argument types, return type
+
+    // statements
+    LET_ASSIGNMENT,   // composites: empty list, name, type or invalid_node, right hand side
+    WHILE_STMT,       // pairs: condition, STATEMENT_LIST body
+    IF_STMT,          // composites: elifs, condition, STATEMENT_LIST body, ELSE_STMT or invalid_node
+    ELIF_STMT,        // pairs: condition, STATEMENT_LIST body
+    ELSE_STMT,        // lists
+    FOR_STMT,         // composites: for elements, STATEMENT_LIST body
+    STATEMENT_LIST,   // lists
+    DIRECT_IMPORT,    // composites: namespace, imported element
+    TYPECLASS_IMPORT, // composites: namespace, typeclass, instance type
+};
+
+// index of a node in a FlatAst
+using NodeId = std::uint32_t;
+
+constexpr NodeId invalid_node = std::numeric_limits<NodeId>::max();
+
+// a contiguous range of node ids in the children array of a FlatAst
+struct NodeRange
+{
+    std::uint32_t begin = 0;
+    std::uint32_t count = 0;
+
+    constexpr auto operator==(const NodeRange&) const noexcept -> bool = default;
+};
+
+// a range of characters in the text array of a FlatAst
+struct TextRef
+{
+    std::uint32_t begin = 0;
+    std::uint32_t length = 0;
+
+    constexpr auto operator==(const TextRef&) const noexcept -> bool = default;
+};
+
+// record of nodes with exactly two children
+struct Pair
+{
+    NodeId first = invalid_node;
+    NodeId second = invalid_node;
+
+    constexpr auto operator==(const Pair&) const noexcept -> bool = default;
+};
+
+// record of nodes with a list of children and up to three single children
+struct Composite
+{
+    NodeRange list;
+    NodeId first = invalid_node;
+    NodeId second = invalid_node;
+    NodeId third = invalid_node;
+
+    constexpr auto operator==(const Composite&) const noexcept -> bool = default;
+};
+
+// all pools are dumped byte wise when serializing a FlatAst
+static_assert(std::is_trivially_copyable_v<NodeRange>);
+static_assert(std::is_trivially_copyable_v<TextRef>);
+static_assert(std::is_trivially_copyable_v<Pair>);
+static_assert(std::is_trivially_copyable_v<Composite>);
+
+} // namespace ast::flat
@@ -2,7 +2,7 @@
 
 #include <ast/common/AreaBase.hpp>
 #include <ast/common/Identifier.hpp>
-#include <vector>
+#include <common/SmallVector.hpp>
 
 namespace ast {
 
@@ -10,7 +10,7 @@ class DirectImport : public AreaBase
 {
 public:
     constexpr DirectImport(lexing::TextArea area,
-                           std::vector<Identifier>&& namespce,
+                           common::SmallVector<Identifier, 2>&& namespce,
                            Identifier element) noexcept
         : AreaBase(area),
           namespce_(std::move(namespce)),
@@ -27,11 +27,11 @@ public:
         return namespce_ == other.namespce_ and imported_element_ == other.imported_element_;
     }
 
-    constexpr auto getNamespace() const noexcept -> const std::vector<Identifier>&
+    constexpr auto getNamespace() const noexcept -> const common::SmallVector<Identifier, 2>&
     {
         return namespce_;
     }
-    constexpr auto getNamespace() noexcept -> std::vector<Identifier>&
+    constexpr auto getNamespace() noexcept -> common::SmallVector<Identifier, 2>&
     {
         return namespce_;
     }
@@ -47,8 +47,10 @@ public:
     }
 
 private:
-    std::vector<Identifier> namespce_;
+    common::SmallVector<Identifier, 2> namespce_;
     Identifier imported_element_;
 };
 
+static_assert(sizeof(DirectImport) <= 64);
+
 } // namespace ast
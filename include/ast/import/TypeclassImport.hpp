@@ -64,5 +64,7 @@ private:
     Type instance_;
 };
 
+static_assert(sizeof(TypeclassImport) <= 120);
+
 
 } // namespace ast
@@ -54,4 +54,6 @@ private:
     std::vector<ast::Statement> body_;
 };
 
+static_assert(sizeof(ForStmt) <= 56);
+
 } // namespace ast
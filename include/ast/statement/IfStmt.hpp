@@ -53,6 +53,8 @@ private:
     std::vector<ast::Statement> body_;
 };
 
+static_assert(sizeof(ElifStmt) <= 64);
+
 class ElseStmt : public AreaBase
 {
 public:
@@ -85,6 +87,8 @@ private:
     std::vector<ast::Statement> body_;
 };
 
+static_assert(sizeof(ElseStmt) <= 32);
+
 class IfStmt : public AreaBase
 {
 public:
@@ -157,4 +161,6 @@ private:
     std::optional<ElseStmt> else_;
 };
 
+static_assert(sizeof(IfStmt) <= 128);
+
 } // namespace ast
@@ -75,4 +75,6 @@ private:
     Expression rhs_;
 };
 
+static_assert(sizeof(LetAssignment) <= 136);
+
 } // namespace ast
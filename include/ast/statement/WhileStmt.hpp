@@ -47,4 +47,6 @@ private:
     std::vector<Statement> body_;
 };
 
+static_assert(sizeof(WhileStmt) <= 64);
+
 } // namespace ast
@@ -6,28 +6,38 @@
 
 namespace ast {
 
-class FunctionParameter : AreaBase
+class FunctionParameter : public AreaBase
 {
 public:
-    FunctionParameter(lexing::TextArea area, Identifier&& name, Type&& type) noexcept
+    constexpr FunctionParameter(lexing::TextArea area, Identifier&& name, Type&& type) noexcept
         : AreaBase(area),
           name_(std::move(name)),
           type_(std::move(type)) {}
+    constexpr FunctionParameter() noexcept = delete;
+    constexpr FunctionParameter(const FunctionParameter&) noexcept = delete;
+    constexpr FunctionParameter(FunctionParameter&&) noexcept = default;
+    constexpr auto operator=(const FunctionParameter&) noexcept -> FunctionParameter& = delete;
+    constexpr auto operator=(FunctionParameter&&) noexcept -> FunctionParameter& = default;
 
-    auto getName() const noexcept -> const Identifier&
+    constexpr auto operator==(const FunctionParameter& other) const noexcept -> bool
+    {
+        return name_ == other.name_ and type_ == other.type_;
+    }
+
+    constexpr auto getName() const noexcept -> const Identifier&
     {
         return name_;
     }
-    auto getName() noexcept -> Identifier&
+    constexpr auto getName() noexcept -> Identifier&
     {
         return name_;
     }
 
-    auto getType() const noexcept -> const Type&
+    constexpr auto getType() const noexcept -> const Type&
     {
         return type_;
     }
-    auto getType() noexcept -> Type&
+    constexpr auto getType() noexcept -> Type&
     {
         return type_;
     }
@@ -37,52 +47,65 @@ private:
     Type type_;
 };
 
-class FunctionDefinition : AreaBase
+class FunctionDefinition : public AreaBase
 {
 public:
-    FunctionDefinition(lexing::TextArea area,
-                       Identifier&& name,
-                       std::vector<FunctionParameter>&& parameters,
-                       Type&& return_type,
-                       std::vector<FunctionStatement>&& body) noexcept
+    constexpr FunctionDefinition(lexing::TextArea area,
+                                 Identifier&& name,
+                                 std::vector<FunctionParameter>&& parameters,
+                                 Type&& return_type,
+                                 std::vector<FunctionStatement>&& body) noexcept
         : AreaBase(area),
           name_(std::move(name)),
           parameters_(std::move(parameters)),
           return_type(std::move(return_type)),
           body_(std::move(body)) {}
+    constexpr FunctionDefinition() noexcept = delete;
+    constexpr FunctionDefinition(const FunctionDefinition&) noexcept = delete;
+    constexpr FunctionDefinition(FunctionDefinition&&) noexcept = default;
+    constexpr auto operator=(const FunctionDefinition&) noexcept -> FunctionDefinition& = delete;
+    constexpr auto operator=(FunctionDefinition&&) noexcept -> FunctionDefinition& = default;
+
+    constexpr auto operator==(const FunctionDefinition& other) const noexcept -> bool
+    {
+        return name_ == other.name_
+            and parameters_ == other.parameters_
+            and return_type == other.return_type
+            and body_ == other.body_;
+    }
 
-    auto getName() const noexcept -> const Identifier&
+    constexpr auto getName() const noexcept -> const Identifier&
     {
         return name_;
     }
-    auto getName() noexcept -> Identifier&
+    constexpr auto getName() noexcept -> Identifier&
     {
         return name_;
     }
 
-    auto getParameters() const noexcept -> const std::vector<FunctionParameter>&
+    constexpr auto getParameters() const noexcept -> const std::vector<FunctionParameter>&
     {
         return parameters_;
     }
-    auto getParameters() noexcept -> std::vector<FunctionParameter>&
+    constexpr auto getParameters() noexcept -> std::vector<FunctionParameter>&
     {
         return parameters_;
     }
 
-    auto getReturnType() const noexcept -> const Type&
+    constexpr auto getReturnType() const noexcept -> const Type&
     {
         return return_type;
     }
-    auto getReturnType() noexcept -> Type&
+    constexpr auto getReturnType() noexcept -> Type&
     {
         return return_type;
     }
 
-    auto getBody() const noexcept -> const std::vector<FunctionStatement>&
+    constexpr auto getBody() const noexcept -> const std::vector<FunctionStatement>&
     {
         return body_;
     }
-    auto getBody() noexcept -> std::vector<FunctionStatement>&
+    constexpr auto getBody() noexcept -> std::vector<FunctionStatement>&
     {
         return body_;
     }
@@ -6,35 +6,44 @@
 
 namespace ast {
 
-class Namespace : AreaBase
+class Namespace : public AreaBase
 {
 public:
-    Namespace(lexing::TextArea area,
-              Identifier&& name,
-              std::vector<ToplevelElement>&& elements) noexcept
+    constexpr Namespace(lexing::TextArea area,
+                        Identifier&& name,
+                        std::vector<ToplevelElement>&& elements) noexcept
         : AreaBase(area),
           name_(std::move(name)),
           elements_(std::move(elements)) {}
+    constexpr Namespace() noexcept = delete;
+    constexpr Namespace(const Namespace&) noexcept = delete;
+    constexpr Namespace(Namespace&&) noexcept = default;
+    constexpr auto operator=(const Namespace&) noexcept -> Namespace& = delete;
+    constexpr auto operator=(Namespace&&) noexcept -> Namespace& = default;
 
-    auto getName() const noexcept -> const Identifier&
+    constexpr auto operator==(const Namespace& other) const noexcept -> bool
+    {
+        return name_ == other.name_ and elements_ == other.elements_;
+    }
+
+    constexpr auto getName() const noexcept -> const Identifier&
     {
         return name_;
     }
-    auto getName() noexcept -> Identifier&
+    constexpr auto getName() noexcept -> Identifier&
     {
         return name_;
     }
 
-    auto getElements() const noexcept -> const std::vector<ToplevelElement>&
+    constexpr auto getElements() const noexcept -> const std::vector<ToplevelElement>&
     {
         return elements_;
     }
-    auto getElements() noexcept -> std::vector<ToplevelElement>&
+    constexpr auto getElements() noexcept -> std::vector<ToplevelElement>&
     {
         return elements_;
     }
 
-
 private:
     Identifier name_;
     std::vector<ToplevelElement> elements_;
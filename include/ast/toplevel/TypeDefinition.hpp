@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ast/Ast.hpp>
+#include <ast/common/AreaBase.hpp>
+#include <lexer/TextArea.hpp>
+
+namespace ast {
+
+// a type definition at the top level, only its name is part of the ast so far
+class TypeDefinition : public AreaBase
+{
+public:
+    constexpr TypeDefinition(lexing::TextArea area, Identifier&& name) noexcept
+        : AreaBase(area),
+          name_(std::move(name)) {}
+    constexpr TypeDefinition() noexcept = delete;
+    constexpr TypeDefinition(const TypeDefinition&) noexcept = delete;
+    constexpr TypeDefinition(TypeDefinition&&) noexcept = default;
+    constexpr auto operator=(const TypeDefinition&) noexcept -> TypeDefinition& = delete;
+    constexpr auto operator=(TypeDefinition&&) noexcept -> TypeDefinition& = default;
+
+    constexpr auto operator==(const TypeDefinition& other) const noexcept -> bool
+    {
+        return name_ == other.name_;
+    }
+
+    constexpr auto getName() const noexcept -> const Identifier&
+    {
+        return name_;
+    }
+    constexpr auto getName() noexcept -> Identifier&
+    {
+        return name_;
+    }
+
+private:
+    Identifier name_;
+};
+
+} // namespace ast
@@ -0,0 +1,40 @@
+#pragma once
+
+#include <ast/Ast.hpp>
+#include <ast/common/AreaBase.hpp>
+#include <lexer/TextArea.hpp>
+
+namespace ast {
+
+// a typeclass definition at the top level, only its name is part of the ast so far
+class TypeclassDefinition : public AreaBase
+{
+public:
+    constexpr TypeclassDefinition(lexing::TextArea area, Identifier&& name) noexcept
+        : AreaBase(area),
+          name_(std::move(name)) {}
+    constexpr TypeclassDefinition() noexcept = delete;
+    constexpr TypeclassDefinition(const TypeclassDefinition&) noexcept = delete;
+    constexpr TypeclassDefinition(TypeclassDefinition&&) noexcept = default;
+    constexpr auto operator=(const TypeclassDefinition&) noexcept -> TypeclassDefinition& = delete;
+    constexpr auto operator=(TypeclassDefinition&&) noexcept -> TypeclassDefinition& = default;
+
+    constexpr auto operator==(const TypeclassDefinition& other) const noexcept -> bool
+    {
+        return name_ == other.name_;
+    }
+
+    constexpr auto getName() const noexcept -> const Identifier&
+    {
+        return name_;
+    }
+    constexpr auto getName() noexcept -> Identifier&
+    {
+        return name_;
+    }
+
+private:
+    Identifier name_;
+};
+
+} // namespace ast
@@ -65,4 +65,6 @@ private:
     Type return_;
 };
 
+static_assert(sizeof(LambdaType) <= 96);
+
 } // namespace ast
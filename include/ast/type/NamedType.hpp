@@ -53,4 +53,6 @@ private:
     Identifier type_;
 };
 
+static_assert(sizeof(NamedType) <= 56);
+
 } // namespace ast
@@ -39,4 +39,6 @@ private:
     Type type_;
 };
 
+static_assert(sizeof(OptionalType) <= 72);
+
 } // namespace ast
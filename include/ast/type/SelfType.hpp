@@ -4,6 +4,7 @@
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
 #include <memory>
+#include <type_traits>
 #include <vector>
 
 namespace ast {
@@ -26,4 +27,7 @@ public:
     }
 };
 
+static_assert(std::is_trivially_copyable_v<SelfType>);
+static_assert(sizeof(SelfType) <= 8);
+
 } // namespace ast
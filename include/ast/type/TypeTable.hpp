@@ -0,0 +1,227 @@
+#pragma once
+
+#include <algorithm>
+#include <ast/Ast.hpp>
+#include <common/Interner.hpp>
+#include <cstddef>
+#include <cstdint>
+#include <functional>
+#include <span>
+#include <unordered_map>
+#include <variant>
+#include <vector>
+
+namespace ast {
+
+enum class TypeKind : std::uint8_t {
+    NAMED,    // operands are the symbols of the namespace followed by the symbol of the name
+    SELF,     // no operands
+    UNION,    // operands are the members, flattened, sorted and without duplicates
+    TUPLE,    // operands are the members
+    OPTIONAL, // the only operand is the inner type
+    LAMBDA,   // operands are the argument types followed by the return type
+};
+
+// handle of a type in a TypeTable
+// two handles of the same table are equal if and only if the types are structurally equal
+using TypeId = std::uint32_t;
+
+// a hash consed table of types.
+// every structurally distinct type is stored exactly once, therefore comparing
+// types is comparing their ids. unions are normalized when they are interned
+// such that (A | B) and (B | (A | B)) are the same type.
+// the table is not thread safe, it is meant to be used by one compilation pass at a time
+class TypeTable
+{
+public:
+    TypeTable() noexcept = default;
+
+    // interns a type of the ast
+    auto intern(const Type& type) noexcept -> TypeId
+    {
+        return std::visit([this](const auto& t) { return intern_node(t); }, type);
+    }
+
+    auto named(std::span<const common::Symbol> path) noexcept -> TypeId
+    {
+        std::vector<std::uint32_t> operands;
+        operands.reserve(path.size());
+
+        for(auto symbol : path) {
+            operands.emplace_back(symbol.get_id());
+        }
+
+        return intern_key(TypeKind::NAMED, std::move(operands));
+    }
+
+    auto self() noexcept -> TypeId
+    {
+        return intern_key(TypeKind::SELF, {});
+    }
+
+    auto optional(TypeId inner) noexcept -> TypeId
+    {
+        return intern_key(TypeKind::OPTIONAL, {inner});
+    }
+
+    auto tuple(std::span<const TypeId> members) noexcept -> TypeId
+    {
+        return intern_key(TypeKind::TUPLE, {members.begin(), members.end()});
+    }
+
+    // members which are unions themselves are flattened into the union
+    // a union of a single distinct type is that type itself
+    auto union_of(std::span<const TypeId> members) noexcept -> TypeId
+    {
+        std::vector<std::uint32_t> operands;
+        operands.reserve(members.size());
+
+        for(auto member : members) {
+            if(get_kind(member) == TypeKind::UNION) {
+                auto nested = get_operands(member);
+                operands.insert(operands.end(), nested.begin(), nested.end());
+            } else {
+                operands.emplace_back(member);
+            }
+        }
+
+        std::sort(operands.begin(), operands.end());
+        operands.erase(std::unique(operands.begin(), operands.end()), operands.end());
+
+        if(operands.size() == 1) {
+            return operands.front();
+        }
+
+        return intern_key(TypeKind::UNION, std::move(operands));
+    }
+
+    auto lambda(std::span<const TypeId> arguments, TypeId return_type) noexcept -> TypeId
+    {
+        std::vector<std::uint32_t> operands{arguments.begin(), arguments.end()};
+        operands.emplace_back(return_type);
+        return intern_key(TypeKind::LAMBDA, std::move(operands));
+    }
+
+    auto get_kind(TypeId type) const noexcept -> TypeKind
+    {
+        return entries_[type].kind;
+    }
+
+    // the meaning of the operands depends on the kind of the type (see TypeKind)
+    auto get_operands(TypeId type) const noexcept -> std::span<const std::uint32_t>
+    {
+        const auto& entry = entries_[type];
+        return std::span<const std::uint32_t>{operands_}.subspan(entry.begin, entry.count);
+    }
+
+    // number of distinct types in the table
+    auto size() const noexcept -> std::size_t
+    {
+        return entries_.size();
+    }
+
+private:
+    struct Key
+    {
+        TypeKind kind;
+        std::vector<std::uint32_t> operands;
+
+        auto operator==(const Key&) const noexcept -> bool = default;
+    };
+
+    struct KeyHash
+    {
+        auto operator()(const Key& key) const noexcept -> std::size_t
+        {
+            auto hash = static_cast<std::size_t>(key.kind);
+            for(auto operand : key.operands) {
+                hash = hash * 0x9e3779b97f4a7c15 + operand;
+            }
+            return hash;
+        }
+    };
+
+    struct Entry
+    {
+        TypeKind kind;
+        std::uint32_t begin;
+        std::uint32_t count;
+    };
+
+    auto intern_key(TypeKind kind, std::vector<std::uint32_t>&& operands) noexcept -> TypeId
+    {
+        Key key{kind, std::move(operands)};
+
+        if(auto iter = ids_.find(key); iter != ids_.end()) {
+            return iter->second;
+        }
+
+        const auto id = static_cast<TypeId>(entries_.size());
+        entries_.emplace_back(Entry{kind,
+                                    static_cast<std::uint32_t>(operands_.size()),
+                                    static_cast<std::uint32_t>(key.operands.size())});
+        operands_.insert(operands_.end(), key.operands.begin(), key.operands.end());
+        ids_.emplace(std::move(key), id);
+
+        return id;
+    }
+
+    auto intern_all(std::span<const Type> types) noexcept -> std::vector<TypeId>
+    {
+        std::vector<TypeId> ids;
+        ids.reserve(types.size());
+
+        for(const auto& type : types) {
+            ids.emplace_back(intern(type));
+        }
+
+        return ids;
+    }
+
+    auto intern_node(const NamedType& type) noexcept -> TypeId
+    {
+        std::vector<common::Symbol> path;
+        path.reserve(type.getNamespace().size() + 1);
+
+        for(const auto& identifier : type.getNamespace()) {
+            path.emplace_back(identifier.getSymbol());
+        }
+        path.emplace_back(type.getName().getSymbol());
+
+        return named(path);
+    }
+
+    auto intern_node(const SelfType& /*unused*/) noexcept -> TypeId
+    {
+        return self();
+    }
+
+    auto intern_node(const Forward<UnionType>& type) noexcept -> TypeId
+    {
+        return union_of(intern_all(type->getTypes()));
+    }
+
+    auto intern_node(const Forward<TupleType>& type) noexcept -> TypeId
+    {
+        return tuple(intern_all(type->getTypes()));
+    }
+
+    auto intern_node(const Forward<OptionalType>& type) noexcept -> TypeId
+    {
+        return optional(intern(type->getType()));
+    }
+
+    auto intern_node(const Forward<LambdaType>& type) noexcept -> TypeId
+    {
+        auto arguments = intern_all(type->getArguments());
+        auto return_type = intern(type->getReturnType());
+        return lambda(arguments, return_type);
+    }
+
+private:
+    std::vector<Entry> entries_;
+    std::vector<std::uint32_t> operands_;
+    std::unordered_map<Key, TypeId, KeyHash> ids_;
+};
+
+} // namespace ast
@@ -3,14 +3,13 @@
 #include <ast/Ast.hpp>
 #include <ast/common/AreaBase.hpp>
 #include <lexer/TextArea.hpp>
-#include <vector>
 
 namespace ast {
 
 class UnionType : public AreaBase
 {
 public:
-    constexpr UnionType(lexing::TextArea area, std::vector<Type>&& types) noexcept
+    constexpr UnionType(lexing::TextArea area, TypeList&& types) noexcept
         : AreaBase(area),
           types_(std::move(types)) {}
 
@@ -30,17 +29,19 @@ public:
         return types_.size();
     }
 
-    constexpr auto getTypes() const noexcept -> const std::vector<Type>&
+    constexpr auto getTypes() const noexcept -> const TypeList&
     {
         return types_;
     }
-    constexpr auto getTypes() noexcept -> std::vector<Type>&
+    constexpr auto getTypes() noexcept -> TypeList&
     {
         return types_;
     }
 
 private:
-    std::vector<Type> types_;
+    TypeList types_;
 };
 
+static_assert(sizeof(UnionType) <= 136);
+
 } // namespace ast
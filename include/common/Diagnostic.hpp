@@ -0,0 +1,77 @@
+#pragma once
+
+#include <common/Error.hpp>
+#include <fmt/core.h>
+#include <lexer/LineIndex.hpp>
+#include <lexer/TextArea.hpp>
+#include <lexer/TokenSet.hpp>
+#include <lexer/Tokens.hpp>
+#include <string>
+#include <variant>
+
+namespace common::error {
+
+namespace detail {
+
+inline auto render_position(lexing::TextArea area, const lexing::LineIndex& lines) -> std::string
+{
+    const auto [line, column] = lines.get_line_column(area.getStart());
+    return fmt::format("{}:{}", line, column);
+}
+
+inline auto render_token_set(lexing::TokenSet tokens) -> std::string
+{
+    std::string result;
+    tokens.for_each([&](lexing::TokenTypes type) {
+        if(not result.empty()) {
+            result += ", ";
+        }
+        result += lexing::get_description(type);
+    });
+    return result;
+}
+
+} // namespace detail
+
+// turns an error into a human readable message prefixed by the line and column it occurred at
+// this is the only place errors are formatted, which only happens once they reach the user
+inline auto render(const Error& error, const lexing::LineIndex& lines) -> std::string
+{
+    return std::visit(
+        [&](const auto& e) -> std::string {
+            using E = std::decay_t<decltype(e)>;
+
+            if constexpr(std::is_same_v<E, UnknownToken>) {
+                return fmt::format("{}: unknown token",
+                                   detail::render_position(e.getArea(), lines));
+            } else if constexpr(std::is_same_v<E, UnclosedString>) {
+                return fmt::format("{}: unclosed string literal",
+                                   detail::render_position(e.getArea(), lines));
+            } else if constexpr(std::is_same_v<E, UnexpectedToken>) {
+                return fmt::format("{}: unexpected {}, expected {}",
+                                   detail::render_position(e.getArea(), lines),
+                                   lexing::get_description(e.getActual()),
+                                   e.getExpected().size() == 1
+                                       ? detail::render_token_set(e.getExpected())
+                                       : "one of " + detail::render_token_set(e.getExpected()));
+            } else if constexpr(std::is_same_v<E, NestingTooDeep>) {
+                return fmt::format("{}: nested deeper than {} levels",
+                                   detail::render_position(e.getArea(), lines),
+                                   e.getLimit());
+            } else if constexpr(std::is_same_v<E, InvalidLambdaParameter>) {
+                return fmt::format("{}: lambda parameters have to be identifiers, typed parameters have to be enclosed by ()",
+                                   detail::render_position(e.getArea(), lines));
+            } else if constexpr(std::is_same_v<E, SourceTooLarge>) {
+                return fmt::format("source of {} bytes is larger than the maximum of {} bytes",
+                                   e.getSize(),
+                                   lexing::max_source_size);
+            } else {
+                return fmt::format("internal compiler error in {}:{}",
+                                   e.getLocation().file_name(),
+                                   e.getLocation().line());
+            }
+        },
+        error);
+}
+
+} // namespace common::error
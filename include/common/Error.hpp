@@ -1,10 +1,13 @@
 #pragma once
 
+#include <cstddef>
+#include <cstdint>
 #include <lexer/TextArea.hpp>
+#include <lexer/TokenSet.hpp>
 #include <lexer/Tokens.hpp>
 #include <source_location>
+#include <type_traits>
 #include <variant>
-#include <vector>
 
 namespace common::error {
 
@@ -14,6 +17,11 @@ public:
     constexpr UnknownToken(lexing::TextArea area) noexcept
         : area_(std::move(area)) {}
 
+    constexpr auto getArea() const noexcept -> lexing::TextArea
+    {
+        return area_;
+    }
+
 private:
     lexing::TextArea area_;
 };
@@ -24,6 +32,11 @@ public:
     constexpr UnclosedString(lexing::TextArea area) noexcept
         : area_(std::move(area)) {}
 
+    constexpr auto getArea() const noexcept -> lexing::TextArea
+    {
+        return area_;
+    }
+
 private:
     lexing::TextArea area_;
 };
@@ -41,10 +54,32 @@ public:
           expected_{std::move(expected)...}
     {}
 
+    constexpr UnexpectedToken(lexing::TokenTypes actual,
+                              lexing::TextArea area,
+                              lexing::TokenSet expected) noexcept
+        : area_(std::move(area)),
+          actual_(std::move(actual)),
+          expected_(expected) {}
+
+    constexpr auto getArea() const noexcept -> lexing::TextArea
+    {
+        return area_;
+    }
+
+    constexpr auto getActual() const noexcept -> lexing::TokenTypes
+    {
+        return actual_;
+    }
+
+    constexpr auto getExpected() const noexcept -> lexing::TokenSet
+    {
+        return expected_;
+    }
+
 private:
     lexing::TextArea area_;
     lexing::TokenTypes actual_;
-    std::vector<lexing::TokenTypes> expected_;
+    lexing::TokenSet expected_;
 };
 
 class InternalCompilerError
@@ -53,10 +88,76 @@ public:
     constexpr InternalCompilerError(std::source_location location = std::source_location::current()) noexcept
         : location_(std::move(location)) {}
 
+    constexpr auto getLocation() const noexcept -> const std::source_location&
+    {
+        return location_;
+    }
+
 private:
     std::source_location location_;
 };
 
-using Error = std::variant<UnknownToken, UnclosedString, UnexpectedToken, InternalCompilerError>;
+// expressions or namespaces nested deeper than the parser allows
+// reported instead of growing the parser state without bound
+class NestingTooDeep
+{
+public:
+    constexpr NestingTooDeep(lexing::TextArea area, std::uint32_t limit) noexcept
+        : area_(std::move(area)),
+          limit_(limit) {}
+
+    constexpr auto getArea() const noexcept -> lexing::TextArea
+    {
+        return area_;
+    }
+
+    constexpr auto getLimit() const noexcept -> std::uint32_t
+    {
+        return limit_;
+    }
+
+private:
+    lexing::TextArea area_;
+    std::uint32_t limit_;
+};
+
+// a lambda parameter which is no identifier like (a + b) => c, or a typed
+// parameter which is not enclosed by () like a: Int => c
+class InvalidLambdaParameter
+{
+public:
+    constexpr InvalidLambdaParameter(lexing::TextArea area) noexcept
+        : area_(std::move(area)) {}
+
+    constexpr auto getArea() const noexcept -> lexing::TextArea
+    {
+        return area_;
+    }
+
+private:
+    lexing::TextArea area_;
+};
+
+// sources larger than lexing::max_source_size cannot be addressed by 32 bit offsets
+class SourceTooLarge
+{
+public:
+    constexpr SourceTooLarge(std::size_t size) noexcept
+        : size_(size) {}
+
+    constexpr auto getSize() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+private:
+    std::size_t size_;
+};
+
+// errors are plain values which are cheap to create and copy, they are
+// only turned into text when they are reported (see common/Diagnostic.hpp)
+using Error = std::variant<UnknownToken, UnclosedString, UnexpectedToken, InternalCompilerError, NestingTooDeep, InvalidLambdaParameter, SourceTooLarge>;
+
+static_assert(std::is_trivially_copyable_v<Error>);
 
 } // namespace common::error
@@ -0,0 +1,170 @@
+#pragma once
+
+#include <array>
+#include <compare>
+#include <cstddef>
+#include <cstdint>
+#include <cstdio>
+#include <cstdlib>
+#include <deque>
+#include <functional>
+#include <mutex>
+#include <optional>
+#include <shared_mutex>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+namespace common {
+
+// id of an interned name
+// two symbols of the same interner are equal if and only if their names are equal
+class Symbol
+{
+public:
+    constexpr explicit Symbol(std::uint32_t id) noexcept
+        : id_(id) {}
+
+    constexpr auto get_id() const noexcept -> std::uint32_t
+    {
+        return id_;
+    }
+
+    constexpr auto operator==(const Symbol&) const noexcept -> bool = default;
+    constexpr auto operator<=>(const Symbol&) const noexcept = default;
+
+private:
+    std::uint32_t id_;
+};
+
+// maps every distinct name to a 32 bit symbol and back.
+// the interner is split into shards by the hash of the name, every shard has its
+// own lock such that threads interning different names rarely wait for each other.
+// the shard of a symbol is stored in its lowest bits, the index in the shard above them.
+// interned names are copied and stay valid as long as the interner lives
+class Interner
+{
+public:
+    constexpr static std::size_t shard_bits = 4;
+    constexpr static std::size_t shard_count = 1 << shard_bits;
+    // the index in a shard has to fit into the bits of a symbol above the shard
+    constexpr static std::size_t max_shard_size = std::size_t{1} << (32 - shard_bits);
+
+    Interner() noexcept = default;
+    Interner(Interner&&) noexcept = delete;
+    Interner(const Interner&) noexcept = delete;
+    auto operator=(Interner&&) noexcept -> Interner& = delete;
+    auto operator=(const Interner&) noexcept -> Interner& = delete;
+
+    // the interner used for all identifiers of the compiler, it is never cleared
+    static auto global() noexcept -> Interner&
+    {
+        static Interner interner;
+        return interner;
+    }
+
+    // symbols cannot represent more names, running out of them is fatal
+    auto intern(std::string_view name) noexcept -> Symbol
+    {
+        auto symbol = try_intern(name);
+        if(not symbol.has_value()) [[unlikely]] {
+            std::fputs("fatal error: too many distinct names, the interner ran out of symbols\n", stderr);
+            std::abort();
+        }
+        return symbol.value();
+    }
+
+    // returns nothing if the shard of name is full, in which case name is not interned
+    auto try_intern(std::string_view name) noexcept -> std::optional<Symbol>
+    {
+        const auto shard_index = std::hash<std::string_view>{}(name) & (shard_count - 1);
+        auto& shard = shards_[shard_index];
+
+        {
+            std::shared_lock lock{shard.mutex};
+            if(auto iter = shard.ids.find(name); iter != shard.ids.end()) {
+                return Symbol{iter->second};
+            }
+        }
+
+        std::unique_lock lock{shard.mutex};
+
+        // another thread could have interned the name in between
+        if(auto iter = shard.ids.find(name); iter != shard.ids.end()) {
+            return Symbol{iter->second};
+        }
+
+        const auto id = make_id(shard.names.size(), shard_index);
+        if(not id.has_value()) {
+            return std::nullopt;
+        }
+
+        // elements of a deque are never moved, therefore views into them stay valid
+        const auto& stored = shard.names.emplace_back(name);
+        shard.ids.emplace(std::string_view{stored}, id.value());
+
+        return Symbol{id.value()};
+    }
+
+    // the id of the name at index in the given shard,
+    // returns nothing if the index does not fit into the bits above the shard
+    constexpr static auto make_id(std::size_t index, std::size_t shard_index) noexcept
+        -> std::optional<std::uint32_t>
+    {
+        if(index >= max_shard_size) {
+            return std::nullopt;
+        }
+        return static_cast<std::uint32_t>((index << shard_bits) | shard_index);
+    }
+
+    // symbol needs to be interned by this interner
+    auto lookup(Symbol symbol) const noexcept -> std::string_view
+    {
+        const auto& shard = shards_[symbol.get_id() & (shard_count - 1)];
+
+        std::shared_lock lock{shard.mutex};
+        return shard.names[symbol.get_id() >> shard_bits];
+    }
+
+    // forgets all interned names, symbols interned before must not be looked up anymore
+    auto clear() noexcept -> void
+    {
+        for(auto& shard : shards_) {
+            std::unique_lock lock{shard.mutex};
+            shard.ids.clear();
+            shard.names.clear();
+        }
+    }
+
+    // number of distinct interned names
+    auto size() const noexcept -> std::size_t
+    {
+        std::size_t size = 0;
+        for(const auto& shard : shards_) {
+            std::shared_lock lock{shard.mutex};
+            size += shard.names.size();
+        }
+        return size;
+    }
+
+private:
+    struct Shard
+    {
+        mutable std::shared_mutex mutex;
+        std::unordered_map<std::string_view, std::uint32_t> ids;
+        std::deque<std::string> names;
+    };
+
+    std::array<Shard, shard_count> shards_;
+};
+
+} // namespace common
+
+template<>
+struct std::hash<common::Symbol>
+{
+    constexpr auto operator()(common::Symbol symbol) const noexcept -> std::size_t
+    {
+        return symbol.get_id();
+    }
+};
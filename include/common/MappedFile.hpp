@@ -0,0 +1,110 @@
+#pragma once
+
+#include <cerrno>
+#include <expected>
+#include <fcntl.h>
+#include <lexer/TextArea.hpp>
+#include <string_view>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <system_error>
+#include <unistd.h>
+#include <utility>
+
+namespace common {
+
+// a read only memory mapping of a whole source file
+// the content can be handed to the lexer and parser without copying it.
+// the mapping is advised for sequential access such that the kernel reads ahead
+class MappedFile
+{
+public:
+    static auto open(const char* path) noexcept
+        -> std::expected<MappedFile, std::error_code>
+    {
+        const auto fd = ::open(path, O_RDONLY | O_CLOEXEC);
+        if(fd < 0) {
+            return std::unexpected(std::error_code{errno, std::system_category()});
+        }
+
+        struct stat info{};
+        if(::fstat(fd, &info) != 0) {
+            auto error = std::error_code{errno, std::system_category()};
+            ::close(fd);
+            return std::unexpected(error);
+        }
+
+        const auto size = static_cast<std::size_t>(info.st_size);
+
+        // token offsets are 32 bit, so larger files cannot be compiled
+        if(size > lexing::max_source_size) {
+            ::close(fd);
+            return std::unexpected(std::make_error_code(std::errc::file_too_large));
+        }
+
+        // empty files cannot be mapped
+        if(size == 0) {
+            ::close(fd);
+            return MappedFile{nullptr, 0};
+        }
+
+        auto* data = ::mmap(nullptr, size, PROT_READ, MAP_PRIVATE, fd, 0);
+
+        if(data == MAP_FAILED) {
+            auto error = std::error_code{errno, std::system_category()};
+            ::close(fd);
+            return std::unexpected(error);
+        }
+
+        // the mapping stays valid after the file descriptor is closed
+        ::close(fd);
+
+        ::madvise(data, size, MADV_SEQUENTIAL);
+
+        return MappedFile{data, size};
+    }
+
+    MappedFile(MappedFile&& other) noexcept
+        : data_(std::exchange(other.data_, nullptr)),
+          size_(std::exchange(other.size_, 0)) {}
+
+    auto operator=(MappedFile&& other) noexcept -> MappedFile&
+    {
+        if(this != &other) {
+            unmap();
+            data_ = std::exchange(other.data_, nullptr);
+            size_ = std::exchange(other.size_, 0);
+        }
+        return *this;
+    }
+
+    MappedFile(const MappedFile&) noexcept = delete;
+    auto operator=(const MappedFile&) noexcept -> MappedFile& = delete;
+
+    ~MappedFile() noexcept
+    {
+        unmap();
+    }
+
+    auto content() const noexcept -> std::string_view
+    {
+        return std::string_view{static_cast<const char*>(data_), size_};
+    }
+
+private:
+    MappedFile(void* data, std::size_t size) noexcept
+        : data_(data), size_(size) {}
+
+    auto unmap() noexcept -> void
+    {
+        if(data_ != nullptr) {
+            ::munmap(data_, size_);
+        }
+    }
+
+private:
+    void* data_;
+    std::size_t size_;
+};
+
+} // namespace common
@@ -0,0 +1,251 @@
+#pragma once
+
+#include <algorithm>
+#include <cstddef>
+#include <cstdint>
+#include <memory>
+#include <new>
+#include <utility>
+#include <vector>
+
+namespace common {
+
+// a vector which stores up to N elements inline and only allocates once it grows beyond that.
+// most child lists of the ast (call arguments, union members, block statements, import paths)
+// hold only a handful of elements, storing them inline saves one heap allocation per list.
+// the element count is kept as 32 bit integers to keep the header small
+template<class T, std::size_t N>
+class SmallVector
+{
+    static_assert(N > 0, "use std::vector if no elements should be stored inline");
+
+public:
+    using value_type = T;
+    using size_type = std::size_t;
+    using iterator = T*;
+    using const_iterator = const T*;
+
+    constexpr static std::size_t inline_capacity = N;
+
+    constexpr SmallVector() noexcept = default;
+
+    // takes over the elements of a std::vector
+    // such that code building lists as std::vector keeps working
+    constexpr SmallVector(std::vector<T>&& other) noexcept
+    {
+        reserve(other.size());
+        for(auto& elem : other) {
+            emplace_back(std::move(elem));
+        }
+    }
+
+    constexpr SmallVector(SmallVector&& other) noexcept
+    {
+        take(std::move(other));
+    }
+
+    constexpr auto operator=(SmallVector&& other) noexcept -> SmallVector&
+    {
+        if(this != &other) {
+            destroy();
+            take(std::move(other));
+        }
+        return *this;
+    }
+
+    constexpr SmallVector(const SmallVector&) = delete;
+    constexpr auto operator=(const SmallVector&) -> SmallVector& = delete;
+
+    constexpr ~SmallVector() noexcept
+    {
+        destroy();
+    }
+
+    constexpr auto operator==(const SmallVector& other) const noexcept -> bool
+    {
+        return std::equal(begin(), end(), other.begin(), other.end());
+    }
+
+    template<class... Args>
+    constexpr auto emplace_back(Args&&... args) noexcept -> T&
+    {
+        if(size_ < capacity_) {
+            auto* elem = std::construct_at(data_ + size_, std::forward<Args>(args)...);
+            size_++;
+            return *elem;
+        }
+
+        // the arguments may refer to an element of this vector, so the new element
+        // is constructed before the old ones are moved into the new storage
+        const auto capacity = static_cast<std::size_t>(capacity_) * 2;
+        auto* memory = std::allocator<T>{}.allocate(capacity);
+        auto* elem = std::construct_at(memory + size_, std::forward<Args>(args)...);
+        relocate(memory, capacity);
+        size_++;
+        return *elem;
+    }
+
+    constexpr auto push_back(T&& value) noexcept -> void
+    {
+        emplace_back(std::move(value));
+    }
+
+    constexpr auto pop_back() noexcept -> void
+    {
+        size_--;
+        std::destroy_at(data_ + size_);
+    }
+
+    constexpr auto reserve(std::size_t capacity) noexcept -> void
+    {
+        if(capacity > capacity_) {
+            grow(capacity);
+        }
+    }
+
+    constexpr auto clear() noexcept -> void
+    {
+        std::destroy(begin(), end());
+        size_ = 0;
+    }
+
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        return size_;
+    }
+
+    constexpr auto capacity() const noexcept -> std::size_t
+    {
+        return capacity_;
+    }
+
+    constexpr auto empty() const noexcept -> bool
+    {
+        return size_ == 0;
+    }
+
+    // true as long as the elements did not have to be moved to the heap
+    constexpr auto is_inline() const noexcept -> bool
+    {
+        return data_ == inline_data();
+    }
+
+    constexpr auto data() noexcept -> T*
+    {
+        return data_;
+    }
+    constexpr auto data() const noexcept -> const T*
+    {
+        return data_;
+    }
+
+    constexpr auto operator[](std::size_t i) noexcept -> T&
+    {
+        return data_[i];
+    }
+    constexpr auto operator[](std::size_t i) const noexcept -> const T&
+    {
+        return data_[i];
+    }
+
+    constexpr auto front() noexcept -> T&
+    {
+        return data_[0];
+    }
+    constexpr auto front() const noexcept -> const T&
+    {
+        return data_[0];
+    }
+
+    constexpr auto back() noexcept -> T&
+    {
+        return data_[size_ - 1];
+    }
+    constexpr auto back() const noexcept -> const T&
+    {
+        return data_[size_ - 1];
+    }
+
+    constexpr auto begin() noexcept -> iterator
+    {
+        return data_;
+    }
+    constexpr auto begin() const noexcept -> const_iterator
+    {
+        return data_;
+    }
+
+    constexpr auto end() noexcept -> iterator
+    {
+        return data_ + size_;
+    }
+    constexpr auto end() const noexcept -> const_iterator
+    {
+        return data_ + size_;
+    }
+
+private:
+    constexpr auto inline_data() noexcept -> T*
+    {
+        return std::launder(reinterpret_cast<T*>(inline_));
+    }
+    constexpr auto inline_data() const noexcept -> const T*
+    {
+        return std::launder(reinterpret_cast<const T*>(inline_));
+    }
+
+    constexpr auto grow(std::size_t capacity) noexcept -> void
+    {
+        relocate(std::allocator<T>{}.allocate(capacity), capacity);
+    }
+
+    // moves the elements into the given heap storage which is then used by this vector
+    constexpr auto relocate(T* memory, std::size_t capacity) noexcept -> void
+    {
+        std::uninitialized_move(begin(), end(), memory);
+        std::destroy(begin(), end());
+        deallocate();
+
+        data_ = memory;
+        capacity_ = static_cast<std::uint32_t>(capacity);
+    }
+
+    // moves the elements of other into this empty vector
+    // heap storage is stolen, inline elements have to be moved one by one
+    constexpr auto take(SmallVector&& other) noexcept -> void
+    {
+        if(other.is_inline()) {
+            std::uninitialized_move(other.begin(), other.end(), inline_data());
+            data_ = inline_data();
+            capacity_ = N;
+            size_ = other.size_;
+            other.clear();
+            return;
+        }
+
+        data_ = std::exchange(other.data_, other.inline_data());
+        capacity_ = std::exchange(other.capacity_, N);
+        size_ = std::exchange(other.size_, 0);
+    }
+
+    constexpr auto deallocate() noexcept -> void
+    {
+        if(not is_inline()) {
+            std::allocator<T>{}.deallocate(data_, capacity_);
+        }
+    }
+
+    constexpr auto destroy() noexcept -> void
+    {
+        clear();
+        deallocate();
+    }
+
+private:
+    T* data_ = inline_data();
+    std::uint32_t size_ = 0;
+    std::uint32_t capacity_ = N;
+    alignas(T) std::byte inline_[N * sizeof(T)];
+};
+
+} // namespace common
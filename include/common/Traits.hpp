@@ -2,9 +2,7 @@
 
 #include <compare>
 #include <cstdint>
-#include <ctre/ctre.hpp>
 #include <fmt/core.h>
-#include <lexer/Regexes.hpp>
 #include <lexer/TextArea.hpp>
 #include <lexer/Tokens.hpp>
 #include <optional>
@@ -0,0 +1,63 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+
+namespace lexing {
+
+// classification of the first byte of a token
+// the lexer uses it to jump directly to the sub-lexer which is able
+// to lex a token starting with that byte
+enum class CharClass : std::uint8_t {
+    UNKNOWN = 0,
+    WHITESPACE,
+    NEWLINE,
+    IDENTIFIER,
+    DIGIT,
+    QUOTE,
+    OPERATOR
+};
+
+namespace detail {
+
+constexpr auto make_char_class_table() noexcept
+    -> std::array<CharClass, 256>
+{
+    std::array<CharClass, 256> table{};
+
+    for(unsigned c = 'a'; c <= 'z'; c++) {
+        table[c] = CharClass::IDENTIFIER;
+    }
+    for(unsigned c = 'A'; c <= 'Z'; c++) {
+        table[c] = CharClass::IDENTIFIER;
+    }
+    table['_'] = CharClass::IDENTIFIER;
+
+    for(unsigned c = '0'; c <= '9'; c++) {
+        table[c] = CharClass::DIGIT;
+    }
+
+    for(unsigned char c : {' ', '\f', '\r', '\t', '\v'}) {
+        table[c] = CharClass::WHITESPACE;
+    }
+    table['\n'] = CharClass::NEWLINE;
+    table['\"'] = CharClass::QUOTE;
+
+    for(unsigned char c : {':', '.', ',', '?', '-', '<', '>', '=', '!', '/',
+                           '+', '*', '%', '(', ')', '{', '}', '|', '&', ';'}) {
+        table[c] = CharClass::OPERATOR;
+    }
+
+    return table;
+}
+
+} // namespace detail
+
+constexpr std::array<CharClass, 256> char_classes = detail::make_char_class_table();
+
+constexpr auto get_char_class(char c) noexcept -> CharClass
+{
+    return char_classes[static_cast<unsigned char>(c)];
+}
+
+} // namespace lexing
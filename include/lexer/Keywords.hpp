@@ -0,0 +1,118 @@
+#pragma once
+
+#include <array>
+#include <cstdint>
+#include <lexer/Tokens.hpp>
+#include <string_view>
+
+namespace lexing {
+
+struct Keyword
+{
+    std::string_view text;
+    TokenTypes type;
+};
+
+// all words which are lexed as their own token instead of as an identifier
+// this is the only place where keywords need to be added, the perfect hash
+// table used by the lexer is generated from this list at compile time
+constexpr std::array keywords{
+    Keyword{"let", TokenTypes::LET},
+    Keyword{"fun", TokenTypes::FUN},
+    Keyword{"type", TokenTypes::TYPE},
+    Keyword{"typeclass", TokenTypes::TYPECLASS},
+    Keyword{"namespace", TokenTypes::NAMESPACE},
+    Keyword{"if", TokenTypes::IF},
+    Keyword{"elif", TokenTypes::ELIF},
+    Keyword{"else", TokenTypes::ELSE},
+    Keyword{"while", TokenTypes::WHILE},
+    Keyword{"for", TokenTypes::FOR},
+    Keyword{"self", TokenTypes::SELF_VALUE},
+    Keyword{"Self", TokenTypes::SELF_TYPE},
+    Keyword{"true", TokenTypes::TRUE},
+    Keyword{"false", TokenTypes::FALSE},
+    Keyword{"_", TokenTypes::UNDERSCORE}};
+
+namespace detail {
+
+constexpr std::size_t keyword_table_size = 32;
+
+static_assert(keyword_table_size >= keywords.size() * 2
+                  and (keyword_table_size & (keyword_table_size - 1)) == 0,
+              "the keyword table size needs to be a power of two with enough free slots");
+
+constexpr auto max_keyword_length = [] {
+    std::size_t max = 0;
+    for(const auto& keyword : keywords) {
+        max = keyword.text.size() > max ? keyword.text.size() : max;
+    }
+    return max;
+}();
+
+// hashes the length, the first two and the last character of a word
+// together with these, seed only needs to be chosen such that no two keywords collide
+constexpr auto keyword_hash(std::string_view word, std::uint32_t seed) noexcept
+    -> std::size_t
+{
+    constexpr std::uint32_t prime = 0x01000193;
+
+    std::uint32_t hash = seed ^ static_cast<std::uint32_t>(word.size());
+    hash = (hash * prime) ^ static_cast<unsigned char>(word.front());
+    hash = (hash * prime) ^ static_cast<unsigned char>(word.size() > 1 ? word[1] : '\0');
+    hash = (hash * prime) ^ static_cast<unsigned char>(word.back());
+    hash ^= hash >> 15;
+
+    return hash & (keyword_table_size - 1);
+}
+
+consteval auto find_keyword_seed() -> std::uint32_t
+{
+    for(std::uint32_t seed = 0; seed < 100000; seed++) {
+        std::array<bool, keyword_table_size> used{};
+        bool collision = false;
+
+        for(const auto& keyword : keywords) {
+            auto slot = keyword_hash(keyword.text, seed);
+            collision = collision or used[slot];
+            used[slot] = true;
+        }
+
+        if(not collision) {
+            return seed;
+        }
+    }
+
+    // makes the constant evaluation fail if no perfect hash was found
+    throw "no collision free seed for the keyword table found";
+}
+
+constexpr std::uint32_t keyword_seed = find_keyword_seed();
+
+constexpr auto keyword_table = [] {
+    std::array<Keyword, keyword_table_size> table{};
+    for(auto& slot : table) {
+        slot = Keyword{"", TokenTypes::IDENTIFIER};
+    }
+
+    for(const auto& keyword : keywords) {
+        table[keyword_hash(keyword.text, keyword_seed)] = keyword;
+    }
+
+    return table;
+}();
+
+} // namespace detail
+
+// given a complete identifier return the keyword token type it represents
+// or TokenTypes::IDENTIFIER if it is no keyword
+constexpr auto classify_word(std::string_view word) noexcept -> TokenTypes
+{
+    if(word.empty() or word.size() > detail::max_keyword_length) {
+        return TokenTypes::IDENTIFIER;
+    }
+
+    const auto& slot = detail::keyword_table[detail::keyword_hash(word, detail::keyword_seed)];
+    return slot.text == word ? slot.type : TokenTypes::IDENTIFIER;
+}
+
+} // namespace lexing
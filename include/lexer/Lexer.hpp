@@ -1,40 +1,58 @@
 #pragma once
 
+#include <array>
 #include <common/Error.hpp>
 #include <compare>
 #include <cstdint>
-#include <ctre/ctre.hpp>
 #include <expected>
 #include <fmt/core.h>
-#include <lexer/Regexes.hpp>
+#include <lexer/CharClasses.hpp>
+#include <lexer/Keywords.hpp>
+#include <lexer/Scanners.hpp>
 #include <lexer/TextArea.hpp>
+#include <lexer/TokenBuffer.hpp>
 #include <lexer/Tokens.hpp>
 #include <optional>
 #include <queue>
 #include <string_view>
-#include <expected>
 #include <vector>
 
 namespace lexing {
 
 class Lexer
 {
-    // helper functions to construct an std::array of size N inplace when the Type T is not default constructable
-    template<size_t... Inds>
-    auto array_from_lexed_impl(std::integer_sequence<size_t, Inds...>) -> std::array<Token, sizeof...(Inds)>
-    {
-        return {lexed_[Inds]...};
-    }
+    // the lookahead is kept in a ring buffer with a fixed capacity
+    // such that peeking at any depth and popping are constant time
+    constexpr static std::size_t lookahead_capacity = 8;
 
-    template<auto N>
-    auto array_from_lexed() -> std::array<Token, N>
+    static_assert((lookahead_capacity & (lookahead_capacity - 1)) == 0,
+                  "the lookahead capacity needs to be a power of two");
+
+    template<size_t... Inds>
+    constexpr auto array_from_lexed_impl(std::integer_sequence<size_t, Inds...>) const noexcept
+        -> std::array<Token, sizeof...(Inds)>
     {
-        return array_from_lexed_impl(std::make_index_sequence<N>{});
+        return {lexed_at(Inds)...};
     }
 
 public:
+    // sources larger than max_source_size are not lexed at all,
+    // the first token is a SourceTooLarge error instead
     constexpr Lexer(std::string_view content) noexcept
-        : content_(content) {}
+        : Lexer(content, 0, content.size()) {}
+
+    // starts lexing source at the given offset, the offsets of
+    // all tokens are still relative to the start of source
+    constexpr Lexer(std::string_view source, std::uint32_t offset) noexcept
+        : Lexer(source.substr(offset), offset, source.size()) {}
+
+    // lexes content which starts at offset of a source with source_size bytes.
+    // the size is checked once here, a source which is too large is never read
+    constexpr Lexer(std::string_view content, std::uint32_t offset, std::size_t source_size) noexcept
+        : content_(source_size > max_source_size ? std::string_view{} : content),
+          position_(offset),
+          source_size_(source_size),
+          too_large_(source_size > max_source_size) {}
 
     constexpr Lexer(Lexer&&) noexcept = default;
     constexpr auto operator=(Lexer&&) noexcept -> Lexer& = default;
@@ -45,35 +63,39 @@ public:
     constexpr auto peek() noexcept -> std::expected<Token, common::error::Error>
         requires(N == 1)
     {
-        if(lexed_.empty()) {
-            auto next = lexNext();
-            if(not next.has_value()) {
-                return next;
-            }
+        return lookahead(0);
+    }
 
-            lexed_.emplace_back(std::move(next.value()));
+    template<auto N>
+    constexpr auto peek() noexcept -> std::optional<std::array<Token, N>>
+        requires(N > 1 and N <= lookahead_capacity)
+    {
+        if(not lookahead(N - 1).has_value()) {
+            return std::nullopt;
         }
 
-        return lexed_.back();
+        return array_from_lexed_impl(std::make_index_sequence<N>{});
     }
 
-    template<auto N>
-    constexpr auto peek() noexcept -> std::optional<std::array<Token, N>>
-        requires(N > 1)
+    // returns the token depth tokens after the next one without popping anything
+    // depth needs to be smaller than the lookahead capacity
+    constexpr auto lookahead(std::size_t depth) noexcept
+        -> std::expected<Token, common::error::Error>
     {
-        while(lexed_.size() < N) {
+        if(depth >= lookahead_capacity) {
+            return std::unexpected(common::error::InternalCompilerError{});
+        }
 
+        while(lexed_count_ <= depth) {
             auto next = lexNext();
-
             if(not next.has_value()) {
-                return std::nullopt;
+                return next;
             }
 
-            lexed_.emplace_back(std::move(next.value()));
+            push_lexed(next.value());
         }
 
-
-        return array_from_lexed<N>();
+        return lexed_at(depth);
     }
 
     // checks if the next token is of the given type
@@ -140,19 +162,25 @@ public:
         return std::nullopt;
     }
 
+    // popping a token which has not been peeked at yet lexes it first
+    // if that fails nothing is popped
     template<auto N = 1ul>
     constexpr auto pop() noexcept -> void
     {
         for(std::size_t i = 0; i < N; i++) {
-            lexed_.pop_back();
+            if(not peek().has_value()) {
+                return;
+            }
+
+            lexed_begin_ = (lexed_begin_ + 1) & (lookahead_capacity - 1);
+            lexed_count_--;
         }
     }
 
     constexpr auto pop_token(TokenTypes type) noexcept -> void
     {
-        while(not lexed_.empty() and lexed_.back().getType() == type) {
-            lexed_.pop_back();
-            peek();
+        while(next_is(type)) {
+            pop();
         }
     }
 
@@ -175,272 +203,222 @@ public:
         return TextArea{position_, position_};
     }
 
-private:
-    constexpr auto lexNext() noexcept -> std::expected<Token, common::error::Error>
+    // lexes all remaining tokens in one go instead of on demand
+    // lexing stops at the first error which is stored in the buffer,
+    // otherwise the last token in the buffer is END_OF_FILE
+    constexpr auto tokenize_all() noexcept -> TokenBuffer
     {
-        const auto start = position_;
+        TokenBuffer buffer;
 
-        if(content_.empty()) {
-            return Token{TokenTypes::END_OF_FILE, start, content_};
-        }
-
-        // skip whitespace
-        if(auto match = ws_re(content_)) {
-            [[maybe_unused]] auto _ = moveForward(match.size());
-            return lexNext();
-        }
+        // typical sources contain roughly one token every four bytes
+        buffer.reserve(content_.size() / 4 + 1);
 
-        if(auto match = nl_re(content_)) {
-            position_ += match.size();
-            auto value = moveForward(match.size());
-            return Token{TokenTypes::NEWLINE, start, value};
+        // tokens which have already been peeked at come first
+        for(std::size_t i = 0; i < lexed_count_; i++) {
+            buffer.push_back(lexed_at(i));
         }
+        lexed_count_ = 0;
 
-
-        if(std::isalpha(content_.front())) {
-            if(let_re(content_)) {
-                auto value = moveForward(3);
-                return Token{TokenTypes::LET, start, value};
-            }
-            if(true_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::TRUE, start, value};
-            }
-            if(false_re(content_)) {
-                auto value = moveForward(5);
-                return Token{TokenTypes::FALSE, start, value};
-            }
-            if(fun_re(content_)) {
-                auto value = moveForward(3);
-                return Token{TokenTypes::FUN, start, value};
-            }
-            if(typeclass_re(content_)) {
-                auto value = moveForward(9);
-                return Token{TokenTypes::TYPECLASS, start, value};
-            }
-            if(type_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::TYPE, start, value};
-            }
-            if(if_re(content_)) {
-                auto value = moveForward(2);
-                return Token{TokenTypes::IF, start, value};
-            }
-            if(elif_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::ELIF, start, value};
-            }
-            if(else_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::ELSE, start, value};
-            }
-            if(for_re(content_)) {
-                auto value = moveForward(3);
-                return Token{TokenTypes::FOR, start, value};
-            }
-            if(while_re(content_)) {
-                auto value = moveForward(5);
-                return Token{TokenTypes::WHILE, start, value};
-            }
-            if(self_value_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::SELF_VALUE, start, value};
-            }
-            if(self_type_re(content_)) {
-                auto value = moveForward(4);
-                return Token{TokenTypes::SELF_TYPE, start, value};
+        while(true) {
+            auto next = lexNext();
+            if(not next.has_value()) {
+                buffer.setError(std::move(next.error()));
+                return buffer;
             }
-        }
-
-        // check _ before identifier to avoid lexing _ as identifier
-        if(underscore_re(content_)) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::UNDERSCORE, start, value};
-        }
 
-        if(auto match = identifier_re(content_)) {
-            auto value = moveForward(match.size());
-            return Token{TokenTypes::IDENTIFIER, start, value};
-        }
+            buffer.push_back(next.value());
 
-        // needs to be checked before integers
-        if(auto match = double_re(content_)) {
-            auto value = moveForward(match.size());
-            return Token{TokenTypes::DOUBLE, start, value};
+            if(next.value().getType() == TokenTypes::END_OF_FILE) {
+                return buffer;
+            }
         }
+    }
 
-        if(auto match = integer_re(content_)) {
-            auto value = moveForward(match.size());
-            return Token{TokenTypes::INTEGER, start, value};
-        }
+private:
+    constexpr auto lexed_at(std::size_t depth) const noexcept -> Token
+    {
+        return lexed_[(lexed_begin_ + depth) & (lookahead_capacity - 1)];
+    }
 
-        if(content_.starts_with("::")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::COLON_COLON, start, value};
-        }
+    constexpr auto push_lexed(Token token) noexcept -> void
+    {
+        lexed_[(lexed_begin_ + lexed_count_) & (lookahead_capacity - 1)] = token;
+        lexed_count_++;
+    }
 
-        if(content_.starts_with(':')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::COLON, start, value};
-        }
+    constexpr auto lexNext() noexcept -> std::expected<Token, common::error::Error>
+    {
+        skipWhitespace();
 
-        if(content_.starts_with('\"')) {
+        if(content_.empty()) {
+            // the content of a too large source is empty, so this is only checked at the end
+            if(too_large_) [[unlikely]] {
+                return std::unexpected(common::error::SourceTooLarge{source_size_});
+            }
+            return makeToken(TokenTypes::END_OF_FILE, position_);
+        }
+
+        // dispatch on the first byte directly to the sub-lexer which
+        // is able to lex a token starting with it
+        switch(get_char_class(content_.front())) {
+        case CharClass::NEWLINE:
+            return lexNewlines();
+        case CharClass::IDENTIFIER:
+            return lexIdentifierOrKeyword();
+        case CharClass::DIGIT:
+            return lexNumber();
+        case CharClass::QUOTE:
             return lexStandardString();
+        case CharClass::OPERATOR:
+            return lexOperator();
+        default:
+            return std::unexpected(make_unknown_token_error());
         }
+    }
 
-        if(content_.starts_with('.')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::DOT, start, value};
-        }
-
-        if(content_.starts_with(',')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::COMMA, start, value};
-        }
-
-        if(content_.starts_with('?')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::QUESTIONMARK, start, value};
-        }
-
-
-        // this needs to be checked before -
-        if(content_.starts_with("->")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::R_ARROW, start, value};
-        }
-
-        // this needs to be checked before <
-        if(content_.starts_with("<-")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::L_ARROW, start, value};
-        }
-
-        // this needs to be checked before <
-        if(content_.starts_with("<=")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::LE, start, value};
-        }
-
-        // this needs to be checked before >
-        if(content_.starts_with(">=")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::GE, start, value};
-        }
-
-        // this needs to be checked before =
-        if(content_.starts_with("==")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::EQ, start, value};
-        }
-
-        // this needs to be checked before !
-        if(content_.starts_with("!=")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::NEQ, start, value};
-        }
-
-        // this needs to be checked before =
-        if(content_.starts_with("=>")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::LAMBDA_ARROW, start, value};
-        }
-
-        // needs to be checked before /
-        if(content_.starts_with("//")) {
-            auto value = skipToNewLine();
-            return Token{TokenTypes::LINE_COMMENT_START, start, value};
-        }
-
-
-        if(content_.starts_with("/")) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::DIVISION, start, value};
-        }
-
-        if(content_.starts_with('<')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::LT, start, value};
-        }
-
-        if(content_.starts_with('>')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::GT, start, value};
-        }
-
-        if(content_.starts_with('=')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::ASSIGN, start, value};
-        }
-
-        if(content_.starts_with('+')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::PLUS, start, value};
-        }
-
-        if(content_.starts_with('-')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::MINUS, start, value};
-        }
-
-        if(content_.starts_with('!')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::LOGICAL_NOT, start, value};
-        }
-
-        if(content_.starts_with('*')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::ASTERIX, start, value};
-        }
+    constexpr auto skipWhitespace() noexcept -> void
+    {
+        [[maybe_unused]] auto _ = moveForward(scanners::whitespace_length(content_));
+    }
 
-        if(content_.starts_with('%')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::PERCENT, start, value};
-        }
+    constexpr auto lexNewlines() noexcept -> std::expected<Token, common::error::Error>
+    {
+        const auto start = position_;
+        moveForward(content_.find_first_not_of('\n'));
+        return makeToken(TokenTypes::NEWLINE, start);
+    }
 
-        if(content_.starts_with('(')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::L_PARANTHESIS, start, value};
-        }
+    // scans the whole word once and decides afterwards with a
+    // perfect hash lookup if it is a keyword or an identifier
+    constexpr auto lexIdentifierOrKeyword() noexcept -> std::expected<Token, common::error::Error>
+    {
+        const auto start = position_;
 
-        if(content_.starts_with(')')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::R_PARANTHESIS, start, value};
-        }
+        auto value = moveForward(scanners::identifier_length(content_));
+        return makeToken(classify_word(value), start);
+    }
 
-        if(content_.starts_with('{')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::L_BRACKET, start, value};
-        }
+    // lexes integers (0|[1-9][0-9]*) and doubles ([0-9]+\.[0-9]*([eE][+\-]?[0-9]+)?)
+    constexpr auto lexNumber() noexcept -> std::expected<Token, common::error::Error>
+    {
+        const auto start = position_;
+        const auto digits_after = [this](std::size_t offset) {
+            return offset < content_.size()
+                ? scanners::digits_length(content_.substr(offset))
+                : 0;
+        };
+
+        const auto integer_part = digits_after(0);
+
+        if(integer_part < content_.size() and content_[integer_part] == '.') {
+            auto length = integer_part + 1;
+            length += digits_after(length);
+
+            if(length < content_.size() and (content_[length] == 'e' or content_[length] == 'E')) {
+                auto exponent_start = length + 1;
+                if(exponent_start < content_.size()
+                   and (content_[exponent_start] == '+' or content_[exponent_start] == '-')) {
+                    exponent_start++;
+                }
+
+                // the exponent only belongs to the double if it has digits
+                if(auto exponent_digits = digits_after(exponent_start); exponent_digits > 0) {
+                    length = exponent_start + exponent_digits;
+                }
+            }
 
-        if(content_.starts_with('}')) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::R_BRACKET, start, value};
+            moveForward(length);
+            return makeToken(TokenTypes::DOUBLE, start);
         }
 
-        if(content_.starts_with("||")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::LOGICAL_OR, start, value};
-        }
-        if(content_.starts_with("&&")) {
-            auto value = moveForward(2);
-            return Token{TokenTypes::LOGICAL_AND, start, value};
-        }
+        // integers with leading zeros are lexed as multiple integers
+        auto length = content_.front() == '0' ? 1 : integer_part;
+        moveForward(length);
+        return makeToken(TokenTypes::INTEGER, start);
+    }
 
-        if(content_.starts_with("|")) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::BITWISE_OR, start, value};
-        }
-        if(content_.starts_with("&")) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::BITWISE_AND, start, value};
-        }
-        if(content_.starts_with(";")) {
-            auto value = moveForward(1);
-            return Token{TokenTypes::SEMICOLON, start, value};
+    // lexes all tokens starting with one of the operator characters
+    // tokens with two characters are decided by looking at the second character
+    constexpr auto lexOperator() noexcept -> std::expected<Token, common::error::Error>
+    {
+        const auto start = position_;
+        const auto second = content_.size() > 1 ? content_[1] : '\0';
+
+        const auto lex = [&](TokenTypes type, std::size_t length) {
+            moveForward(length);
+            return makeToken(type, start);
+        };
+
+        switch(content_.front()) {
+        case ':':
+            return second == ':'
+                ? lex(TokenTypes::COLON_COLON, 2)
+                : lex(TokenTypes::COLON, 1);
+        case '.':
+            return lex(TokenTypes::DOT, 1);
+        case ',':
+            return lex(TokenTypes::COMMA, 1);
+        case '?':
+            return lex(TokenTypes::QUESTIONMARK, 1);
+        case '-':
+            return second == '>'
+                ? lex(TokenTypes::R_ARROW, 2)
+                : lex(TokenTypes::MINUS, 1);
+        case '<':
+            if(second == '-') {
+                return lex(TokenTypes::L_ARROW, 2);
+            }
+            return second == '='
+                ? lex(TokenTypes::LE, 2)
+                : lex(TokenTypes::LT, 1);
+        case '>':
+            return second == '='
+                ? lex(TokenTypes::GE, 2)
+                : lex(TokenTypes::GT, 1);
+        case '=':
+            if(second == '=') {
+                return lex(TokenTypes::EQ, 2);
+            }
+            return second == '>'
+                ? lex(TokenTypes::LAMBDA_ARROW, 2)
+                : lex(TokenTypes::ASSIGN, 1);
+        case '!':
+            return second == '='
+                ? lex(TokenTypes::NEQ, 2)
+                : lex(TokenTypes::LOGICAL_NOT, 1);
+        case '/':
+            if(second == '/') {
+                skipToNewLine();
+                return makeToken(TokenTypes::LINE_COMMENT_START, start);
+            }
+            return lex(TokenTypes::DIVISION, 1);
+        case '+':
+            return lex(TokenTypes::PLUS, 1);
+        case '*':
+            return lex(TokenTypes::ASTERIX, 1);
+        case '%':
+            return lex(TokenTypes::PERCENT, 1);
+        case '(':
+            return lex(TokenTypes::L_PARANTHESIS, 1);
+        case ')':
+            return lex(TokenTypes::R_PARANTHESIS, 1);
+        case '{':
+            return lex(TokenTypes::L_BRACKET, 1);
+        case '}':
+            return lex(TokenTypes::R_BRACKET, 1);
+        case '|':
+            return second == '|'
+                ? lex(TokenTypes::LOGICAL_OR, 2)
+                : lex(TokenTypes::BITWISE_OR, 1);
+        case '&':
+            return second == '&'
+                ? lex(TokenTypes::LOGICAL_AND, 2)
+                : lex(TokenTypes::BITWISE_AND, 1);
+        case ';':
+            return lex(TokenTypes::SEMICOLON, 1);
+        default:
+            return std::unexpected(make_unknown_token_error());
         }
-
-        return std::unexpected(make_unknown_token_error());
     }
 
     constexpr auto make_unknown_token_error() noexcept
@@ -450,6 +428,12 @@ private:
         return common::error::UnknownToken{std::move(area)};
     }
 
+    // creates a token spanning from start to the current position
+    constexpr auto makeToken(TokenTypes type, std::uint32_t start) const noexcept -> Token
+    {
+        return Token{type, start, position_ - start};
+    }
+
     constexpr auto moveForward(std::size_t n) noexcept -> std::string_view
     {
         n = std::min(content_.size(), n);
@@ -473,38 +457,38 @@ private:
     }
 
     // TODO: implement f-strings
+    // jumps from one " or \ to the next, a \ escapes whatever character follows it
     constexpr auto lexStandardString() noexcept -> std::expected<Token, common::error::Error>
     {
-        // start at i = to skip first "
-        bool last_was_slash = false;
+        // start at i = 1 to skip first "
         std::size_t i = 1;
-        for(; i < content_.length(); i++) {
-            if(content_[i] == '\"' and not last_was_slash) {
-                break;
-            }
+        while(i < content_.size()) {
+            i += scanners::string_special_offset(content_.substr(i));
 
-            last_was_slash = content_[i] == '\\' and not last_was_slash;
-        }
+            if(i < content_.size() and content_[i] == '\"') {
+                const auto start = position_;
+                moveForward(i + 1);
 
-        // TODO: here there should be a 'missing closing "'-error be reported somehow
-        if(content_[i] != '\"') [[unlikely]] {
-            TextArea area{position_, position_};
-            common::error::Error error = common::error::UnclosedString{std::move(area)};
-            return std::unexpected(std::move(error));
-        }
+                return makeToken(TokenTypes::STANDARD_STRING, start);
+            }
 
-        const auto start = position_;
-        const auto value = moveForward(i + 1);
+            // skip the \ and the escaped character
+            i += 2;
+        }
 
-        return Token{TokenTypes::STANDARD_STRING, start, value};
+        TextArea area{position_, position_};
+        common::error::Error error = common::error::UnclosedString{std::move(area)};
+        return std::unexpected(std::move(error));
     }
 
 private:
     std::string_view content_;
-    std::uint64_t position_;
-    std::size_t line_ = 0;
-    std::size_t column_ = 0;
-    std::vector<Token> lexed_;
+    std::uint32_t position_ = 0;
+    std::size_t source_size_;
+    bool too_large_;
+    std::array<Token, lookahead_capacity> lexed_;
+    std::size_t lexed_begin_ = 0;
+    std::size_t lexed_count_ = 0;
 };
 
 } // namespace lexing
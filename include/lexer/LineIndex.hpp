@@ -0,0 +1,65 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <lexer/Scanners.hpp>
+#include <string_view>
+#include <vector>
+
+namespace lexing {
+
+// a position in a source, both line and column start at 1
+// the column is counted in bytes
+struct LineColumn
+{
+    std::uint64_t line;
+    std::uint64_t column;
+
+    constexpr auto operator==(const LineColumn&) const noexcept -> bool = default;
+};
+
+// maps byte offsets of a source to lines and columns
+// the table of line starts is only built when the first position is resolved,
+// such that the lexer does not need to track lines and sources without
+// diagnostics never pay for it. it is not safe to resolve the first
+// position concurrently from multiple threads
+class LineIndex
+{
+public:
+    constexpr explicit LineIndex(std::string_view source) noexcept
+        : source_(source) {}
+
+    constexpr auto get_line_column(std::uint64_t offset) const noexcept -> LineColumn
+    {
+        const auto& starts = get_line_starts();
+
+        // the line of offset is the last one starting at or before it
+        auto iter = std::upper_bound(starts.begin(), starts.end(), offset);
+        const auto line = static_cast<std::uint64_t>(iter - starts.begin());
+
+        return LineColumn{line, offset - *std::prev(iter) + 1};
+    }
+
+    constexpr auto get_line_count() const noexcept -> std::size_t
+    {
+        return get_line_starts().size();
+    }
+
+    // offsets at which the lines of the source start, the first line starts at 0
+    constexpr auto get_line_starts() const noexcept -> const std::vector<std::uint32_t>&
+    {
+        if(line_starts_.empty()) {
+            line_starts_.resize(scanners::count_newlines(source_) + 1);
+            line_starts_.front() = 0;
+            scanners::line_starts(source_, line_starts_.data() + 1);
+        }
+
+        return line_starts_;
+    }
+
+private:
+    std::string_view source_;
+    mutable std::vector<std::uint32_t> line_starts_;
+};
+
+} // namespace lexing
@@ -0,0 +1,188 @@
+#pragma once
+
+#include <algorithm>
+#include <cstdint>
+#include <lexer/Lexer.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/Tokens.hpp>
+#include <optional>
+#include <string_view>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <vector>
+
+// lexing of large sources in parallel.
+// the source is split into chunks which start right after a run of newlines,
+// every chunk is lexed as if a token starts at its beginning. this guess is wrong
+// if the chunk starts inside of a string literal, the tokens of such a chunk are
+// repaired when the chunks are merged: the merge re-lexes serially from the last
+// correct token until it reaches a token which the chunk lexed at the same offset.
+// because the lexer has no state besides its position, all following tokens
+// of the chunk are correct from there on
+namespace lexing {
+
+namespace detail {
+
+// chunks smaller than this are not worth the overhead of lexing them in parallel
+constexpr std::size_t min_parallel_chunk_size = 64 * 1024;
+
+struct LexedChunk
+{
+    std::uint32_t begin;
+    std::uint32_t end;
+    TokenBuffer tokens;
+    // offset of the first token which starts at or after end
+    std::uint32_t next_offset;
+};
+
+// returns the start offsets of the chunks followed by the end of the source
+inline auto split_into_chunks(std::string_view source, std::size_t chunk_count) noexcept
+    -> std::vector<std::uint32_t>
+{
+    std::vector<std::uint32_t> boundaries{0};
+
+    for(std::size_t i = 1; i < chunk_count; i++) {
+        auto boundary = source.find('\n', source.size() / chunk_count * i);
+        boundary = source.find_first_not_of('\n', std::min(boundary, source.size()));
+        boundary = std::min(boundary, source.size());
+
+        if(boundary > boundaries.back()) {
+            boundaries.emplace_back(boundary);
+        }
+    }
+
+    if(boundaries.back() < source.size()) {
+        boundaries.emplace_back(source.size());
+    }
+
+    return boundaries;
+}
+
+// lexes all tokens which start in [begin, end), the last one may reach beyond end
+inline auto lex_chunk(std::string_view source, std::uint32_t begin, std::uint32_t end) noexcept
+    -> LexedChunk
+{
+    LexedChunk chunk{begin, end, TokenBuffer{}, end};
+    chunk.tokens.reserve((end - begin) / 4 + 1);
+
+    Lexer lexer{source, begin};
+
+    while(true) {
+        auto next = lexer.peek_and_pop();
+        if(not next.has_value()) {
+            chunk.tokens.setError(std::move(next.error()));
+            return chunk;
+        }
+
+        if(next.value().getOffset() >= end) {
+            chunk.next_offset = next.value().getOffset();
+            return chunk;
+        }
+
+        chunk.tokens.push_back(next.value());
+    }
+}
+
+// appends the correct tokens of chunk to result given the offset of the next correct token
+// returns the offset of the next token after the chunk or nothing if lexing failed
+inline auto merge_chunk(std::string_view source,
+                        const LexedChunk& chunk,
+                        std::uint32_t next,
+                        TokenBuffer& result) noexcept
+    -> std::optional<std::uint32_t>
+{
+    const auto& offsets = chunk.tokens.getOffsets();
+
+    // returns true if the chunk lexed a token at offset
+    // in that case all its tokens starting from there are correct
+    const auto splice = [&](std::uint32_t offset) {
+        auto iter = std::lower_bound(offsets.begin(), offsets.end(), offset);
+        if(iter == offsets.end() or *iter != offset) {
+            return false;
+        }
+
+        result.append(chunk.tokens, iter - offsets.begin());
+        return true;
+    };
+
+    Lexer lexer{source, next};
+
+    while(true) {
+        auto token = lexer.peek_and_pop();
+        if(not token.has_value()) {
+            result.setError(std::move(token.error()));
+            return std::nullopt;
+        }
+
+        const auto offset = token.value().getOffset();
+        if(offset >= chunk.end) {
+            return offset;
+        }
+
+        if(splice(offset)) {
+            break;
+        }
+
+        result.push_back(token.value());
+    }
+
+    if(chunk.tokens.hasError()) {
+        result.setError(chunk.tokens.getError().value());
+        return std::nullopt;
+    }
+
+    return chunk.next_offset;
+}
+
+} // namespace detail
+
+// lexes source split into the given number of chunks in parallel
+// the resulting buffer is identical to the one of Lexer::tokenize_all
+inline auto tokenize_parallel(std::string_view source, std::size_t chunk_count) noexcept
+    -> TokenBuffer
+{
+    // chunk boundaries are 32 bit offsets, too large sources are rejected by the lexer
+    if(chunk_count <= 1 or source.size() > max_source_size) {
+        return Lexer{source}.tokenize_all();
+    }
+
+    const auto boundaries = detail::split_into_chunks(source, chunk_count);
+    std::vector<detail::LexedChunk> chunks(boundaries.size() - 1);
+
+    tbb::parallel_for(std::size_t{0}, chunks.size(), [&](std::size_t i) {
+        chunks[i] = detail::lex_chunk(source, boundaries[i], boundaries[i + 1]);
+    });
+
+    TokenBuffer result;
+    result.reserve(source.size() / 4 + 1);
+
+    std::uint32_t next = 0;
+    for(const auto& chunk : chunks) {
+        // a token reaches over the whole chunk
+        if(next >= chunk.end) {
+            continue;
+        }
+
+        auto next_opt = detail::merge_chunk(source, chunk, next, result);
+        if(not next_opt.has_value()) {
+            return result;
+        }
+
+        next = next_opt.value();
+    }
+
+    result.push_back(Token{TokenTypes::END_OF_FILE, next, 0});
+    return result;
+}
+
+// lexes source in parallel with one chunk per thread of the current task arena
+// small sources are split into fewer chunks or lexed serially
+inline auto tokenize_parallel(std::string_view source) noexcept
+    -> TokenBuffer
+{
+    const auto threads = static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+    const auto chunk_count = std::min(threads, source.size() / detail::min_parallel_chunk_size);
+    return tokenize_parallel(source, chunk_count);
+}
+
+} // namespace lexing
@@ -0,0 +1,427 @@
+#pragma once
+
+#include <cstddef>
+#include <cstdint>
+#include <lexer/CharClasses.hpp>
+#include <string_view>
+
+#if defined(__x86_64__) || defined(__i386__)
+#include <immintrin.h>
+#define NEON_LEXER_X86_KERNELS 1
+#endif
+
+// kernels which find the end of runs of characters of the same class
+// they are used by the lexer for whitespace, identifiers and digits.
+// additionally there are kernels which count and collect newlines for the line index.
+// on x86 the kernels classify 16 (SSE2) or 32 (AVX2) bytes per step, the
+// implementation is selected once at startup depending on the cpu.
+// every run kernel takes the range [begin, end) and returns a pointer to the first
+// character which does not belong to the run
+namespace lexing::scanners {
+
+namespace scalar {
+
+constexpr auto is_whitespace(char c) noexcept -> bool
+{
+    return get_char_class(c) == CharClass::WHITESPACE;
+}
+
+constexpr auto is_digit(char c) noexcept -> bool
+{
+    return get_char_class(c) == CharClass::DIGIT;
+}
+
+constexpr auto is_identifier_char(char c) noexcept -> bool
+{
+    const auto char_class = get_char_class(c);
+    return char_class == CharClass::IDENTIFIER or char_class == CharClass::DIGIT;
+}
+
+constexpr auto whitespace(const char* begin, const char* end) noexcept -> const char*
+{
+    while(begin != end and is_whitespace(*begin)) {
+        begin++;
+    }
+    return begin;
+}
+
+constexpr auto identifier(const char* begin, const char* end) noexcept -> const char*
+{
+    while(begin != end and is_identifier_char(*begin)) {
+        begin++;
+    }
+    return begin;
+}
+
+constexpr auto digits(const char* begin, const char* end) noexcept -> const char*
+{
+    while(begin != end and is_digit(*begin)) {
+        begin++;
+    }
+    return begin;
+}
+
+// finds the next character which ends or escapes inside a string literal
+constexpr auto string_special(const char* begin, const char* end) noexcept -> const char*
+{
+    while(begin != end and *begin != '\"' and *begin != '\\') {
+        begin++;
+    }
+    return begin;
+}
+
+constexpr auto count_newlines(const char* begin, const char* end) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for(; begin != end; begin++) {
+        count += *begin == '\n';
+    }
+    return count;
+}
+
+// writes the offset behind every newline in [begin, end) relative to start to out
+constexpr auto line_starts(const char* start, const char* begin, const char* end, std::uint32_t* out) noexcept
+    -> std::uint32_t*
+{
+    for(; begin != end; begin++) {
+        if(*begin == '\n') {
+            *out++ = static_cast<std::uint32_t>(begin - start + 1);
+        }
+    }
+    return out;
+}
+
+} // namespace scalar
+
+#ifdef NEON_LEXER_X86_KERNELS
+
+namespace sse2 {
+
+inline auto in_range(__m128i chunk, char low, char high) noexcept -> __m128i
+{
+    return _mm_and_si128(_mm_cmpgt_epi8(chunk, _mm_set1_epi8(low - 1)),
+                         _mm_cmplt_epi8(chunk, _mm_set1_epi8(high + 1)));
+}
+
+// ' ', '\t', '\v', '\f' and '\r' but not '\n'
+inline auto whitespace_mask(__m128i chunk) noexcept -> __m128i
+{
+    auto controls = _mm_andnot_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n')),
+                                     in_range(chunk, '\t', '\r'));
+    return _mm_or_si128(controls, _mm_cmpeq_epi8(chunk, _mm_set1_epi8(' ')));
+}
+
+inline auto digit_mask(__m128i chunk) noexcept -> __m128i
+{
+    return in_range(chunk, '0', '9');
+}
+
+// setting the 0x20 bit maps upper case letters onto lower case letters
+inline auto identifier_mask(__m128i chunk) noexcept -> __m128i
+{
+    auto lower = _mm_or_si128(chunk, _mm_set1_epi8(0x20));
+    auto letters = in_range(lower, 'a', 'z');
+    auto underscores = _mm_cmpeq_epi8(chunk, _mm_set1_epi8('_'));
+    return _mm_or_si128(_mm_or_si128(letters, underscores), digit_mask(chunk));
+}
+
+template<auto Mask, auto ScalarKernel>
+inline auto scan(const char* begin, const char* end) noexcept -> const char*
+{
+    while(end - begin >= 16) {
+        auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+        auto mismatches = ~static_cast<unsigned>(_mm_movemask_epi8(Mask(chunk))) & 0xFFFFu;
+        if(mismatches != 0) {
+            return begin + __builtin_ctz(mismatches);
+        }
+        begin += 16;
+    }
+
+    return ScalarKernel(begin, end);
+}
+
+inline auto whitespace(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<whitespace_mask, scalar::whitespace>(begin, end);
+}
+
+inline auto identifier(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<identifier_mask, scalar::identifier>(begin, end);
+}
+
+inline auto digits(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<digit_mask, scalar::digits>(begin, end);
+}
+
+// matches everything but " and \ such that the scan stops at them
+inline auto not_string_special_mask(__m128i chunk) noexcept -> __m128i
+{
+    auto specials = _mm_or_si128(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\"')),
+                                 _mm_cmpeq_epi8(chunk, _mm_set1_epi8('\\')));
+    return _mm_xor_si128(specials, _mm_set1_epi8(-1));
+}
+
+inline auto string_special(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<not_string_special_mask, scalar::string_special>(begin, end);
+}
+
+inline auto newline_mask(const char* begin) noexcept -> unsigned
+{
+    auto chunk = _mm_loadu_si128(reinterpret_cast<const __m128i*>(begin));
+    return static_cast<unsigned>(_mm_movemask_epi8(_mm_cmpeq_epi8(chunk, _mm_set1_epi8('\n'))));
+}
+
+inline auto count_newlines(const char* begin, const char* end) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for(; end - begin >= 16; begin += 16) {
+        count += __builtin_popcount(newline_mask(begin));
+    }
+    return count + scalar::count_newlines(begin, end);
+}
+
+inline auto line_starts(const char* start, const char* begin, const char* end, std::uint32_t* out) noexcept
+    -> std::uint32_t*
+{
+    for(; end - begin >= 16; begin += 16) {
+        const auto offset = static_cast<std::uint32_t>(begin - start + 1);
+        for(auto mask = newline_mask(begin); mask != 0; mask &= mask - 1) {
+            *out++ = offset + __builtin_ctz(mask);
+        }
+    }
+    return scalar::line_starts(start, begin, end, out);
+}
+
+} // namespace sse2
+
+namespace avx2 {
+
+#define NEON_AVX2 __attribute__((target("avx2")))
+
+NEON_AVX2 inline auto in_range(__m256i chunk, char low, char high) noexcept -> __m256i
+{
+    return _mm256_and_si256(_mm256_cmpgt_epi8(chunk, _mm256_set1_epi8(low - 1)),
+                            _mm256_cmpgt_epi8(_mm256_set1_epi8(high + 1), chunk));
+}
+
+NEON_AVX2 inline auto whitespace_mask(__m256i chunk) noexcept -> __m256i
+{
+    auto controls = _mm256_andnot_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n')),
+                                        in_range(chunk, '\t', '\r'));
+    return _mm256_or_si256(controls, _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8(' ')));
+}
+
+NEON_AVX2 inline auto digit_mask(__m256i chunk) noexcept -> __m256i
+{
+    return in_range(chunk, '0', '9');
+}
+
+NEON_AVX2 inline auto identifier_mask(__m256i chunk) noexcept -> __m256i
+{
+    auto lower = _mm256_or_si256(chunk, _mm256_set1_epi8(0x20));
+    auto letters = in_range(lower, 'a', 'z');
+    auto underscores = _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('_'));
+    return _mm256_or_si256(_mm256_or_si256(letters, underscores), digit_mask(chunk));
+}
+
+// the sse2 kernel handles the tail which is shorter than 32 bytes
+template<auto Mask, auto TailKernel>
+NEON_AVX2 inline auto scan(const char* begin, const char* end) noexcept -> const char*
+{
+    while(end - begin >= 32) {
+        auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+        auto mismatches = ~static_cast<unsigned>(_mm256_movemask_epi8(Mask(chunk)));
+        if(mismatches != 0) {
+            return begin + __builtin_ctz(mismatches);
+        }
+        begin += 32;
+    }
+
+    return TailKernel(begin, end);
+}
+
+NEON_AVX2 inline auto whitespace(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<whitespace_mask, sse2::whitespace>(begin, end);
+}
+
+NEON_AVX2 inline auto identifier(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<identifier_mask, sse2::identifier>(begin, end);
+}
+
+NEON_AVX2 inline auto digits(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<digit_mask, sse2::digits>(begin, end);
+}
+
+NEON_AVX2 inline auto not_string_special_mask(__m256i chunk) noexcept -> __m256i
+{
+    auto specials = _mm256_or_si256(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\"')),
+                                    _mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\\')));
+    return _mm256_xor_si256(specials, _mm256_set1_epi8(-1));
+}
+
+NEON_AVX2 inline auto string_special(const char* begin, const char* end) noexcept -> const char*
+{
+    return scan<not_string_special_mask, sse2::string_special>(begin, end);
+}
+
+NEON_AVX2 inline auto newline_mask(const char* begin) noexcept -> unsigned
+{
+    auto chunk = _mm256_loadu_si256(reinterpret_cast<const __m256i*>(begin));
+    return static_cast<unsigned>(_mm256_movemask_epi8(_mm256_cmpeq_epi8(chunk, _mm256_set1_epi8('\n'))));
+}
+
+NEON_AVX2 inline auto count_newlines(const char* begin, const char* end) noexcept -> std::size_t
+{
+    std::size_t count = 0;
+    for(; end - begin >= 32; begin += 32) {
+        count += __builtin_popcount(newline_mask(begin));
+    }
+    return count + sse2::count_newlines(begin, end);
+}
+
+NEON_AVX2 inline auto line_starts(const char* start, const char* begin, const char* end, std::uint32_t* out) noexcept
+    -> std::uint32_t*
+{
+    for(; end - begin >= 32; begin += 32) {
+        const auto offset = static_cast<std::uint32_t>(begin - start + 1);
+        for(auto mask = newline_mask(begin); mask != 0; mask &= mask - 1) {
+            *out++ = offset + __builtin_ctz(mask);
+        }
+    }
+    return sse2::line_starts(start, begin, end, out);
+}
+
+#undef NEON_AVX2
+
+} // namespace avx2
+
+#endif
+
+namespace detail {
+
+using Kernel = const char* (*)(const char*, const char*) noexcept;
+using CountKernel = std::size_t (*)(const char*, const char*) noexcept;
+using LineStartKernel = std::uint32_t* (*)(const char*, const char*, const char*, std::uint32_t*) noexcept;
+
+struct Kernels
+{
+    Kernel whitespace;
+    Kernel identifier;
+    Kernel digits;
+    Kernel string_special;
+    CountKernel count_newlines;
+    LineStartKernel line_starts;
+};
+
+inline auto select_kernels() noexcept -> Kernels
+{
+#ifdef NEON_LEXER_X86_KERNELS
+    // the cpu model may not be initialized yet if this runs during static initialization
+    __builtin_cpu_init();
+    if(__builtin_cpu_supports("avx2")) {
+        return Kernels{avx2::whitespace, avx2::identifier, avx2::digits, avx2::string_special,
+                       avx2::count_newlines, avx2::line_starts};
+    }
+    return Kernels{sse2::whitespace, sse2::identifier, sse2::digits, sse2::string_special,
+                   sse2::count_newlines, sse2::line_starts};
+#else
+    return Kernels{scalar::whitespace, scalar::identifier, scalar::digits, scalar::string_special,
+                   scalar::count_newlines, scalar::line_starts};
+#endif
+}
+
+// the kernels are selected on first use instead of by a dynamic initializer
+// such that scanning during the static initialization of other translation units works
+inline auto kernels() noexcept -> const Kernels&
+{
+    static const Kernels selected = select_kernels();
+    return selected;
+}
+
+} // namespace detail
+
+// the following functions return the length of the run of the respective
+// character class at the start of text
+
+constexpr auto whitespace_length(std::string_view text) noexcept -> std::size_t
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::whitespace(begin, end) - begin;
+    } else {
+        return detail::kernels().whitespace(begin, end) - begin;
+    }
+}
+
+constexpr auto identifier_length(std::string_view text) noexcept -> std::size_t
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::identifier(begin, end) - begin;
+    } else {
+        return detail::kernels().identifier(begin, end) - begin;
+    }
+}
+
+constexpr auto digits_length(std::string_view text) noexcept -> std::size_t
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::digits(begin, end) - begin;
+    } else {
+        return detail::kernels().digits(begin, end) - begin;
+    }
+}
+
+// returns the offset of the first " or \ in text or the size of text if there is none
+constexpr auto string_special_offset(std::string_view text) noexcept -> std::size_t
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::string_special(begin, end) - begin;
+    } else {
+        return detail::kernels().string_special(begin, end) - begin;
+    }
+}
+
+constexpr auto count_newlines(std::string_view text) noexcept -> std::size_t
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::count_newlines(begin, end);
+    } else {
+        return detail::kernels().count_newlines(begin, end);
+    }
+}
+
+// writes the offset behind every newline in text to out
+// out needs to have space for count_newlines(text) offsets
+constexpr auto line_starts(std::string_view text, std::uint32_t* out) noexcept -> std::uint32_t*
+{
+    const auto* begin = text.data();
+    const auto* end = begin + text.size();
+
+    if consteval {
+        return scalar::line_starts(begin, begin, end, out);
+    } else {
+        return detail::kernels().line_starts(begin, begin, end, out);
+    }
+}
+
+} // namespace lexing::scanners
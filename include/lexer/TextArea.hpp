@@ -1,22 +1,30 @@
 #pragma once
 
+#include <cstddef>
 #include <cstdint>
+#include <limits>
+#include <type_traits>
 
 namespace lexing {
 
+// the largest source in bytes whose offsets still fit into 32 bit
+constexpr std::size_t max_source_size = std::numeric_limits<std::uint32_t>::max();
+
+// a range of offsets in the source
+// offsets are 32 bit like the ones of tokens, larger sources are rejected by the lexer
 class TextArea
 {
 
 public:
-    constexpr TextArea(std::uint64_t start, std::uint64_t end) noexcept
+    constexpr TextArea(std::uint32_t start, std::uint32_t end) noexcept
         : start_(start), end_(end) {}
 
-    constexpr auto getStart() const noexcept -> std::uint64_t
+    constexpr auto getStart() const noexcept -> std::uint32_t
     {
         return start_;
     }
 
-    constexpr auto getEnd() const noexcept -> std::uint64_t
+    constexpr auto getEnd() const noexcept -> std::uint32_t
     {
         return end_;
     }
@@ -28,9 +36,14 @@ public:
                         first.end_ > second.end_ ? first.end_ : second.end_};
     }
 
+    constexpr auto operator==(const TextArea&) const noexcept -> bool = default;
+
 private:
-    std::uint64_t start_;
-    std::uint64_t end_;
+    std::uint32_t start_;
+    std::uint32_t end_;
 };
 
+static_assert(std::is_trivially_copyable_v<TextArea>);
+static_assert(sizeof(TextArea) == 8);
+
 } // namespace lexing
@@ -0,0 +1,111 @@
+#pragma once
+
+#include <common/Error.hpp>
+#include <cstdint>
+#include <lexer/TextArea.hpp>
+#include <lexer/Tokens.hpp>
+#include <optional>
+#include <vector>
+
+namespace lexing {
+
+// all tokens of a source stored as structure of arrays
+// such that scanning over the types during parsing touches as little memory as possible.
+// if lexing failed, the buffer contains all tokens before the error and the error itself
+// otherwise the last token is always END_OF_FILE
+class TokenBuffer
+{
+public:
+    constexpr TokenBuffer() noexcept = default;
+
+    constexpr auto reserve(std::size_t n) noexcept -> void
+    {
+        types_.reserve(n);
+        offsets_.reserve(n);
+        lengths_.reserve(n);
+    }
+
+    constexpr auto push_back(Token token) noexcept -> void
+    {
+        types_.emplace_back(token.getType());
+        offsets_.emplace_back(token.getOffset());
+        lengths_.emplace_back(token.getLength());
+    }
+
+    // appends the tokens of other starting with the token at index begin
+    constexpr auto append(const TokenBuffer& other, std::size_t begin) noexcept -> void
+    {
+        append(other, begin, other.size());
+    }
+
+    // appends the tokens of other with an index in [begin, end)
+    constexpr auto append(const TokenBuffer& other, std::size_t begin, std::size_t end) noexcept -> void
+    {
+        types_.insert(types_.end(), other.types_.begin() + begin, other.types_.begin() + end);
+        offsets_.insert(offsets_.end(), other.offsets_.begin() + begin, other.offsets_.begin() + end);
+        lengths_.insert(lengths_.end(), other.lengths_.begin() + begin, other.lengths_.begin() + end);
+    }
+
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        return types_.size();
+    }
+
+    constexpr auto empty() const noexcept -> bool
+    {
+        return types_.empty();
+    }
+
+    constexpr auto operator[](std::size_t i) const noexcept -> Token
+    {
+        return Token{types_[i], offsets_[i], lengths_[i]};
+    }
+
+    constexpr auto getType(std::size_t i) const noexcept -> TokenTypes
+    {
+        return types_[i];
+    }
+
+    constexpr auto getOffset(std::size_t i) const noexcept -> std::uint32_t
+    {
+        return offsets_[i];
+    }
+
+    constexpr auto getLength(std::size_t i) const noexcept -> std::uint32_t
+    {
+        return lengths_[i];
+    }
+
+    constexpr auto getTypes() const noexcept -> const std::vector<TokenTypes>&
+    {
+        return types_;
+    }
+
+    constexpr auto getOffsets() const noexcept -> const std::vector<std::uint32_t>&
+    {
+        return offsets_;
+    }
+
+    constexpr auto setError(common::error::Error error) noexcept -> void
+    {
+        error_ = std::move(error);
+    }
+
+    constexpr auto getError() const noexcept -> const std::optional<common::error::Error>&
+    {
+        return error_;
+    }
+
+    constexpr auto hasError() const noexcept -> bool
+    {
+        return error_.has_value();
+    }
+
+private:
+    std::vector<TokenTypes> types_;
+    std::vector<std::uint32_t> offsets_;
+    std::vector<std::uint32_t> lengths_;
+    std::optional<common::error::Error> error_;
+};
+
+} // namespace lexing
@@ -0,0 +1,216 @@
+#pragma once
+
+#include <algorithm>
+#include <array>
+#include <common/Error.hpp>
+#include <cstdint>
+#include <expected>
+#include <lexer/TextArea.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/Tokens.hpp>
+#include <optional>
+#include <utility>
+
+namespace lexing {
+
+// walks over an already lexed TokenBuffer
+// it offers the same interface as the Lexer such that the parser does not need
+// to know if the tokens are lexed on demand or up front.
+// peeking at any depth and popping are just index operations
+class TokenCursor
+{
+    template<size_t... Inds>
+    constexpr auto array_from_buffer_impl(std::integer_sequence<size_t, Inds...>) const noexcept
+        -> std::array<Token, sizeof...(Inds)>
+    {
+        return {token_at(index_ + Inds)...};
+    }
+
+public:
+    constexpr explicit TokenCursor(TokenBuffer buffer) noexcept
+        : buffer_(std::move(buffer)) {}
+
+    constexpr TokenCursor(TokenCursor&&) noexcept = default;
+    constexpr auto operator=(TokenCursor&&) noexcept -> TokenCursor& = default;
+    constexpr TokenCursor(const TokenCursor&) noexcept = delete;
+    constexpr auto operator=(const TokenCursor&) noexcept -> TokenCursor& = delete;
+
+    template<auto N = 1>
+    constexpr auto peek() noexcept -> std::expected<Token, common::error::Error>
+        requires(N == 1)
+    {
+        if(index_ >= buffer_.size() and buffer_.hasError()) {
+            return std::unexpected(buffer_.getError().value());
+        }
+
+        return token_at(index_);
+    }
+
+    template<auto N>
+    constexpr auto peek() noexcept -> std::optional<std::array<Token, N>>
+        requires(N > 1)
+    {
+        if(index_ + N > buffer_.size() and buffer_.hasError()) {
+            return std::nullopt;
+        }
+
+        return array_from_buffer_impl(std::make_index_sequence<N>{});
+    }
+
+    // returns the token depth tokens after the next one without popping anything
+    constexpr auto lookahead(std::size_t depth) const noexcept
+        -> std::expected<Token, common::error::Error>
+    {
+        if(index_ + depth >= buffer_.size() and buffer_.hasError()) {
+            return std::unexpected(buffer_.getError().value());
+        }
+
+        return token_at(index_ + depth);
+    }
+
+    // checks if the next token is of the given type
+    constexpr auto next_is(TokenTypes type) const noexcept -> bool
+    {
+        return index_ < buffer_.size()
+            ? buffer_.getType(index_) == type
+            : not buffer_.hasError() and type == TokenTypes::END_OF_FILE;
+    }
+
+    constexpr auto next_is_operator() noexcept -> bool
+    {
+        if(auto result = peek()) {
+            return result.value().isOperator();
+        }
+        return false;
+    }
+
+    constexpr auto next_is_prefix_operator() noexcept -> bool
+    {
+        if(auto result = peek()) {
+            return result.value().isPrefixOperator();
+        }
+        return false;
+    }
+
+    constexpr auto next_is_postfix_operator() noexcept -> bool
+    {
+        if(auto result = peek()) {
+            return result.value().isPostfixOperator();
+        }
+        return false;
+    }
+
+    constexpr auto next_is_infix_operator() noexcept -> bool
+    {
+        if(auto result = peek()) {
+            return result.value().isInfixOperator();
+        }
+        return false;
+    }
+
+    // checks if the next token is of the given type and pops it if so
+    // if not return false
+    constexpr auto pop_next_is(TokenTypes type) noexcept -> bool
+    {
+        if(next_is(type)) {
+            pop();
+            return true;
+        }
+
+        return false;
+    }
+
+    constexpr auto next_area() noexcept -> std::optional<TextArea>
+    {
+        if(auto result = peek()) {
+            return result.value().getArea();
+        }
+        return std::nullopt;
+    }
+
+    // the END_OF_FILE token at the end of the buffer is never popped
+    template<auto N = 1ul>
+    constexpr auto pop() noexcept -> void
+    {
+        const auto last = buffer_.hasError() or buffer_.empty()
+            ? buffer_.size()
+            : buffer_.size() - 1;
+        index_ = std::min(index_ + N, last);
+    }
+
+    constexpr auto pop_token(TokenTypes type) noexcept -> void
+    {
+        while(index_ < buffer_.size() and buffer_.getType(index_) == type) {
+            index_++;
+        }
+    }
+
+    constexpr auto pop_ws() noexcept -> void
+    {
+        pop_token(TokenTypes::WHITESPACE);
+    }
+
+    template<auto N = 1>
+    constexpr auto peek_and_pop() noexcept
+    {
+        auto res = peek<N>();
+        pop<N>();
+        return res;
+    }
+
+    constexpr auto get_current_position() const noexcept
+        -> TextArea
+    {
+        const auto offset = index_ < buffer_.size()
+            ? buffer_.getOffset(index_)
+            : get_end_offset();
+
+        return TextArea{offset, offset};
+    }
+
+    // the index of the next token which has not been popped yet
+    struct Checkpoint
+    {
+        std::size_t index;
+    };
+
+    // saving and rewinding to a checkpoint are just index operations
+    // such that the parser can speculatively parse an alternative and go back if it fails
+    constexpr auto checkpoint() const noexcept -> Checkpoint
+    {
+        return Checkpoint{index_};
+    }
+
+    constexpr auto rewind(Checkpoint checkpoint) noexcept -> void
+    {
+        index_ = checkpoint.index;
+    }
+
+    constexpr auto get_buffer() const noexcept -> const TokenBuffer&
+    {
+        return buffer_;
+    }
+
+private:
+    // tokens behind the end of the buffer are END_OF_FILE tokens
+    constexpr auto token_at(std::size_t index) const noexcept -> Token
+    {
+        if(index < buffer_.size()) {
+            return buffer_[index];
+        }
+
+        const auto end = get_end_offset();
+        return Token{TokenTypes::END_OF_FILE, end, 0};
+    }
+
+    constexpr auto get_end_offset() const noexcept -> std::uint32_t
+    {
+        return buffer_.empty() ? 0 : buffer_[buffer_.size() - 1].getArea().getEnd();
+    }
+
+private:
+    TokenBuffer buffer_;
+    std::size_t index_ = 0;
+};
+
+} // namespace lexing
@@ -0,0 +1,79 @@
+#pragma once
+
+#include <bit>
+#include <concepts>
+#include <cstddef>
+#include <cstdint>
+#include <lexer/Tokens.hpp>
+#include <type_traits>
+
+namespace lexing {
+
+// END_OF_FILE is always the last token type
+constexpr std::size_t token_type_count = static_cast<std::size_t>(TokenTypes::END_OF_FILE) + 1;
+
+// a set of token types stored as one bit per type
+// errors use it to list the tokens which would have been accepted, building it
+// never allocates such that failing parse alternatives stay cheap
+class TokenSet
+{
+public:
+    constexpr TokenSet() noexcept = default;
+
+    template<class... Types>
+        requires(std::same_as<Types, TokenTypes> and ...)
+    constexpr explicit TokenSet(Types... types) noexcept
+        : bits_((bit(types) | ... | std::uint64_t{0})) {}
+
+    constexpr auto insert(TokenTypes type) noexcept -> void
+    {
+        bits_ |= bit(type);
+    }
+
+    constexpr auto contains(TokenTypes type) const noexcept -> bool
+    {
+        return (bits_ & bit(type)) != 0;
+    }
+
+    constexpr auto size() const noexcept -> std::size_t
+    {
+        return static_cast<std::size_t>(std::popcount(bits_));
+    }
+
+    constexpr auto empty() const noexcept -> bool
+    {
+        return bits_ == 0;
+    }
+
+    constexpr auto operator|(TokenSet other) const noexcept -> TokenSet
+    {
+        TokenSet result;
+        result.bits_ = bits_ | other.bits_;
+        return result;
+    }
+
+    constexpr auto operator==(const TokenSet&) const noexcept -> bool = default;
+
+    // calls f with every token type of the set in the order they are declared in
+    template<class F>
+    constexpr auto for_each(F&& f) const noexcept -> void
+    {
+        for(auto bits = bits_; bits != 0; bits &= bits - 1) {
+            f(static_cast<TokenTypes>(std::countr_zero(bits)));
+        }
+    }
+
+private:
+    constexpr static auto bit(TokenTypes type) noexcept -> std::uint64_t
+    {
+        return std::uint64_t{1} << static_cast<std::uint8_t>(type);
+    }
+
+private:
+    std::uint64_t bits_ = 0;
+};
+
+static_assert(token_type_count <= 64, "TokenSet stores one bit per token type in 64 bits");
+static_assert(std::is_trivially_copyable_v<TokenSet>);
+
+} // namespace lexing
@@ -2,13 +2,13 @@
 
 #include <compare>
 #include <cstdint>
-#include <ctre/ctre.hpp>
 #include <lexer/TextArea.hpp>
 #include <optional>
+#include <string_view>
 
 namespace lexing {
 
-enum class TokenTypes : std::int64_t {
+enum class TokenTypes : std::uint8_t {
     LET = 0,
     FUN,
     INTEGER,
@@ -16,6 +16,7 @@ enum class TokenTypes : std::int64_t {
     DOUBLE,
     TYPE,
     TYPECLASS,
+    NAMESPACE,
     WHITESPACE,
     NEWLINE,
     UNDERSCORE,
@@ -87,6 +88,8 @@ constexpr auto get_description(TokenTypes token) noexcept -> std::string_view
         return "TYPE";
     case TokenTypes::TYPECLASS:
         return "TYPECLASS";
+    case TokenTypes::NAMESPACE:
+        return "NAMESPACE";
     case TokenTypes::WHITESPACE:
         return "WHITESPACE";
     case TokenTypes::NEWLINE:
@@ -180,31 +183,40 @@ constexpr auto get_description(TokenTypes token) noexcept -> std::string_view
 
 
 
+// a token only stores its type and where it is located in the source
+// its value is a view into the source which is rebuilt on demand, this keeps
+// a token at 12 bytes such that many of them fit into the cache during lookahead.
+// because of the 32 bit offsets sources are limited to 4GiB
 class Token
 {
 
 public:
-    constexpr Token(TokenTypes type, TextArea area,
-                    std::string_view value) noexcept
-        : type_(type), area_(area), value_(value) {}
-
-    constexpr Token(TokenTypes type, std::uint64_t start,
-                    std::string_view value) noexcept
-        : type_(type),
-          area_{start, start + value.size()},
-          value_(value) {}
+    constexpr Token() noexcept = default;
+    constexpr Token(TokenTypes type, std::uint32_t offset,
+                    std::uint32_t length) noexcept
+        : offset_(offset), length_(length), type_(type) {}
 
     constexpr auto getType() const noexcept -> TokenTypes
     {
         return type_;
     }
+    constexpr auto getOffset() const noexcept -> std::uint32_t
+    {
+        return offset_;
+    }
+    constexpr auto getLength() const noexcept -> std::uint32_t
+    {
+        return length_;
+    }
     constexpr auto getArea() const noexcept -> TextArea
     {
-        return area_;
+        return TextArea{offset_, offset_ + length_};
     }
-    constexpr auto getValue() const noexcept -> std::string_view
+
+    // source needs to be the whole text the token was lexed from
+    constexpr auto getValue(std::string_view source) const noexcept -> std::string_view
     {
-        return value_;
+        return source.substr(offset_, length_);
     }
 
     constexpr auto isSeparator() const noexcept -> bool
@@ -252,9 +264,11 @@ public:
 
 
 private:
-    TokenTypes type_;
-    TextArea area_;
-    std::string_view value_;
+    std::uint32_t offset_ = 0;
+    std::uint32_t length_ = 0;
+    TokenTypes type_ = TokenTypes::END_OF_FILE;
 };
 
+static_assert(sizeof(Token) <= 12);
+
 } // namespace lexing
@@ -2,7 +2,9 @@
 
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -13,62 +15,59 @@ template<class T>
 class BlockExpressionParser
 {
 public:
-    constexpr auto block_expression() noexcept -> std::optional<ast::BlockExpr>
+    constexpr auto block_expression() noexcept
+        -> std::expected<ast::BlockExpr, common::error::Error>
     {
+        using lexing::TokenTypes;
+
         auto result = try_singe_expr_block();
-        if(std::holds_alternative<std::nullopt_t>(result)) {
-            // TODO: propagate error
-            return std::nullopt;
+        if(not result.has_value()) {
+            return std::unexpected(std::move(result.error()));
         }
 
-        if(std::holds_alternative<ast::BlockExpr>(result)) {
-            return std::move(std::get<ast::BlockExpr>(result));
+        if(std::holds_alternative<ast::BlockExpr>(result.value())) {
+            return std::move(std::get<ast::BlockExpr>(result.value()));
         }
 
-        auto [start, stmts] = std::move(std::get<1>(result));
+        auto [start, stmts] = std::move(std::get<1>(result.value()));
 
         // clang-format off
-                if(not(block_expr_lexer().pop_next_is(lexing::TokenTypes::SEMICOLON) or
-                           block_expr_lexer().pop_next_is(lexing::TokenTypes::NEWLINE))) {
-                  // TODO: return error "expected newline or ;"
-                  return std::nullopt;
+                if(not(block_expr_lexer().pop_next_is(TokenTypes::SEMICOLON) or
+                           block_expr_lexer().pop_next_is(TokenTypes::NEWLINE))) {
+                  return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::NEWLINE, TokenTypes::SEMICOLON));
                 }
         // clang-format on
 
-        while(not block_expr_lexer().next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            auto stmt_opt = static_cast<T*>(this)->statement();
-            if(not stmt_opt.has_value()) {
-                // TODO: propagate error
-                return std::nullopt;
+        while(not block_expr_lexer().next_is(TokenTypes::LAMBDA_ARROW)) {
+            auto stmt_res = static_cast<T*>(this)->statement();
+            if(not stmt_res.has_value()) {
+                return std::unexpected(std::move(stmt_res.error()));
             }
-            auto stmt = std::move(stmt_opt.value());
+            auto stmt = std::move(stmt_res.value());
 
             stmts.emplace_back(std::move(stmt));
 
             // clang-format off
-                        if(not(block_expr_lexer().pop_next_is(lexing::TokenTypes::SEMICOLON) or
-                                   block_expr_lexer().pop_next_is(lexing::TokenTypes::NEWLINE))) {
-                                // TODO: return error "expected newline or ;"
-                                return std::nullopt;
+                        if(not(block_expr_lexer().pop_next_is(TokenTypes::SEMICOLON) or
+                                   block_expr_lexer().pop_next_is(TokenTypes::NEWLINE))) {
+                                return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::NEWLINE, TokenTypes::SEMICOLON));
                         }
             // clang-format on
         }
 
-        if(not block_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            // TODO: return error "a block expression needs to return an expression with =>expr"
-            return std::nullopt;
+        // a block expression with statements returns its value with => expr
+        if(not block_expr_lexer().pop_next_is(TokenTypes::LAMBDA_ARROW)) {
+            return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::LAMBDA_ARROW));
         }
 
-        auto expr_opt = static_cast<T*>(this)->expression();
-        if(not expr_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto expr_res = static_cast<T*>(this)->expression();
+        if(not expr_res.has_value()) {
+            return std::unexpected(std::move(expr_res.error()));
         }
-        auto expr = std::move(expr_opt.value());
+        auto expr = std::move(expr_res.value());
 
-        if(not block_expr_lexer().next_is(lexing::TokenTypes::R_BRACKET)) {
-            // TODO: return error: "expected } after block return statment"
-            return std::nullopt;
+        if(not block_expr_lexer().next_is(TokenTypes::R_BRACKET)) {
+            return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::R_BRACKET));
         }
 
         auto end = block_expr_lexer().peek_and_pop().value().getArea();
@@ -78,29 +77,29 @@ public:
 
 private:
     constexpr auto try_singe_expr_block() noexcept
-        -> std::variant<ast::BlockExpr,
-                        std::pair<lexing::TextArea, std::vector<ast::Statement>>,
-                        std::nullopt_t>
+        -> std::expected<std::variant<ast::BlockExpr,
+                                      std::pair<lexing::TextArea, ast::StatementList>>,
+                         common::error::Error>
     {
-        if(not block_expr_lexer().next_is(lexing::TokenTypes::L_BRACKET)) {
-            return std::nullopt;
+        using lexing::TokenTypes;
+
+        if(not block_expr_lexer().next_is(TokenTypes::L_BRACKET)) {
+            return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::L_BRACKET));
         }
 
         auto start = block_expr_lexer().peek_and_pop().value().getArea();
 
         // handle the case of a expr block which only contains a
         //{=> <expr>} without any statements pre the return statement
-        if(block_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            auto ret_expr_opt = static_cast<T*>(this)->expression();
-            if(not ret_expr_opt.has_value()) {
-                // TODO: propagate error
-                return std::nullopt;
+        if(block_expr_lexer().pop_next_is(TokenTypes::LAMBDA_ARROW)) {
+            auto ret_expr_res = static_cast<T*>(this)->expression();
+            if(not ret_expr_res.has_value()) {
+                return std::unexpected(std::move(ret_expr_res.error()));
             }
-            auto ret_expr = std::move(ret_expr_opt.value());
+            auto ret_expr = std::move(ret_expr_res.value());
 
-            if(not block_expr_lexer().next_is(lexing::TokenTypes::R_BRACKET)) {
-                // TODO: return "expected }" error
-                return std::nullopt;
+            if(not block_expr_lexer().next_is(TokenTypes::R_BRACKET)) {
+                return std::unexpected(unexpected_next_token(block_expr_lexer(), TokenTypes::R_BRACKET));
             }
 
             auto end = block_expr_lexer().peek_and_pop().value().getArea();
@@ -111,14 +110,13 @@ private:
                                   std::move(ret_expr)};
         }
 
-        auto stmt_opt = static_cast<T*>(this)->statement();
-        if(not stmt_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto stmt_res = static_cast<T*>(this)->statement();
+        if(not stmt_res.has_value()) {
+            return std::unexpected(std::move(stmt_res.error()));
         }
-        auto stmt = std::move(stmt_opt.value());
+        auto stmt = std::move(stmt_res.value());
 
-        if(block_expr_lexer().next_is(lexing::TokenTypes::R_BRACKET)
+        if(block_expr_lexer().next_is(TokenTypes::R_BRACKET)
            and std::holds_alternative<ast::Expression>(stmt)) {
 
             auto end = block_expr_lexer().peek_and_pop().value().getArea();
@@ -131,14 +129,14 @@ private:
 
 
 
-        std::vector<ast::Statement> stmts;
+        ast::StatementList stmts;
         stmts.emplace_back(std::move(stmt));
 
         return std::pair{start, std::move(stmts)};
     }
 
 private:
-    constexpr auto block_expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto block_expr_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
@@ -3,14 +3,17 @@
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
 #include <common/Error.hpp>
+#include <common/SmallVector.hpp>
+#include <cstdint>
 #include <exception>
 #include <expected>
-#include <lexer/Lexer.hpp>
+#include <lexer/TokenCursor.hpp>
 #include <lexer/Tokens.hpp>
 #include <optional>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
+#include <utility>
 
 namespace parser {
 
@@ -19,20 +22,54 @@ template<class T>
 class ExpressionPrattParser
 {
 public:
+    // nested expressions like (...), {...} or call arguments parse their inner
+    // expressions by calling this method again, those levels count towards the nesting limit
     constexpr auto expression() noexcept
         -> std::expected<ast::Expression, common::error::Error>
     {
-        return expression_bp(0);
+        auto& depth = static_cast<T*>(this)->nesting_depth_;
+
+        if(depth >= max_nesting_depth()) {
+            return std::unexpected(nesting_too_deep());
+        }
+
+        depth++;
+        auto result = expression_bp(0);
+        depth--;
+
+        return result;
+    }
+
+    // parses the condition of a statement which is followed by the { of its block.
+    // directly in the condition a { does not call the expression before it,
+    // nested expressions like (f{a}) are parsed as usual
+    constexpr auto condition() noexcept
+        -> std::expected<ast::Expression, common::error::Error>
+    {
+        auto& condition_depth = static_cast<T*>(this)->condition_depth_;
+
+        const auto outer = std::exchange(condition_depth, static_cast<T*>(this)->nesting_depth_ + 1);
+        auto result = expression();
+        condition_depth = outer;
+
+        return result;
     }
 
 private:
+    // true if the next { ends the condition which is being parsed instead of starting a call
+    constexpr auto starts_condition_block() noexcept -> bool
+    {
+        return expr_lexer().next_is(lexing::TokenTypes::L_BRACKET)
+            and static_cast<T*>(this)->condition_depth_ == static_cast<T*>(this)->nesting_depth_;
+    }
+
     constexpr auto function_params(lexing::TokenTypes end_token) noexcept
-        -> std::expected<std::vector<ast::Expression>, common::error::Error>
+        -> std::expected<ast::ExpressionList, common::error::Error>
     {
         using common::error::UnexpectedToken;
         using lexing::TokenTypes;
 
-        std::vector<ast::Expression> params;
+        ast::ExpressionList params;
         while(not expr_lexer().next_is(end_token)) {
             auto res = expression();
             if(not res.has_value()) {
@@ -61,127 +98,190 @@ private:
         return params;
     }
 
+    // an operator whose right hand side is still being parsed
+    // lhs is empty for prefix operators, min_bp is the binding power
+    // which was active before the operator was read
+    struct PendingOperator
+    {
+        lexing::Token op;
+        std::optional<ast::Expression> lhs;
+        std::uint32_t min_bp;
+    };
+
+    // operator precedence parsing with an explicit stack instead of recursion
+    // parsing the right hand side of an operator pushes the operator, once the rhs
+    // cannot be extended anymore (the next operator binds weaker) the operator is popped
+    // and combined with it. this gives the same trees as the recursive pratt parser
+    // but long operator chains like !!!!x or a = b = c only grow the heap allocated stack
     constexpr auto expression_bp(std::uint32_t min_bp) noexcept
         -> std::expected<ast::Expression, common::error::Error>
     {
-        using common::error::UnexpectedToken;
         using common::error::Error;
         using common::error::InternalCompilerError;
-        using lexing::TokenTypes;
 
-        // lhs() parses prefix operators
-        auto lhs_res = lhs();
-        if(not lhs_res.has_value()) {
-            return lhs_res;
-        }
-        auto lhs = std::move(lhs_res.value());
-
-        while(expr_lexer().next_is_operator()) {
-            const auto op = expr_lexer().peek().value();
+        common::SmallVector<PendingOperator, 4> pending;
 
-            // parse postfix operators such as function calls
-            if(auto bp_opt = postfix_binding_power(op.getType())) {
-                auto bp = std::move(bp_opt.value());
+        while(true) {
+            // parse prefix operators, their operand is parsed in the next iteration
+            while(expr_lexer().next_is_prefix_operator()) {
+                auto op = expr_lexer().peek_and_pop().value();
 
-                if(bp < min_bp) {
-                    break;
+                auto r_bp_opt = prefix_binding_power(op.getType());
+                if(not r_bp_opt.has_value()) {
+                    Error error = InternalCompilerError{};
+                    return std::unexpected(std::move(error));
                 }
 
-                expr_lexer().pop();
+                if(pending.size() + static_cast<T*>(this)->nesting_depth_ >= max_nesting_depth()) {
+                    return std::unexpected(nesting_too_deep(op.getArea()));
+                }
 
-                auto end_token = op.getType() == TokenTypes::L_BRACKET
-                    ? TokenTypes::R_BRACKET
-                    : TokenTypes::R_PARANTHESIS;
+                pending.emplace_back(op, std::nullopt, min_bp);
+                min_bp = r_bp_opt.value();
+            }
 
-                auto params_res = function_params(end_token);
-                if(not params_res.has_value()) {
-                    return std::unexpected(std::move(params_res.error()));
+            auto lhs_res = simple_expr();
+            if(not lhs_res.has_value()) {
+                return lhs_res;
+            }
+            auto lhs = std::move(lhs_res.value());
+
+            // extend lhs with operators binding at least as strong as min_bp
+            // and reduce pending operators once lhs cannot be extended anymore
+            while(true) {
+                auto op_opt = next_operator(min_bp);
+                if(not op_opt.has_value()) {
+                    return std::unexpected(std::move(op_opt.error()));
                 }
-                auto params = std::move(params_res.value());
 
-                auto end_token_res = expr_lexer().peek_and_pop();
-                if(not end_token_res.has_value()) {
-                    return std::unexpected(std::move(end_token_res.error()));
+                // the next operator is an infix operator, its rhs is parsed next
+                if(auto op = op_opt.value()) {
+                    const auto [l_bp, r_bp] = infix_binding_power(op->getType()).value();
+
+                    if(pending.size() + static_cast<T*>(this)->nesting_depth_ >= max_nesting_depth()) {
+                        return std::unexpected(nesting_too_deep(op->getArea()));
+                    }
+
+                    expr_lexer().pop();
+                    pending.emplace_back(op.value(), std::move(lhs), min_bp);
+                    min_bp = r_bp;
+                    break;
                 }
-                auto actual_end_token = std::move(end_token_res.value());
 
-                if(actual_end_token.getType() != end_token) {
-                    UnexpectedToken error{actual_end_token.getType(),
-                                          actual_end_token.getArea(),
-                                          end_token};
+                // postfix operators are applied directly
+                if(expr_lexer().next_is_postfix_operator()
+                   and not starts_condition_block()
+                   and postfix_binding_power(expr_lexer().peek().value().getType()) >= min_bp) {
+                    auto call_res = function_call(std::move(lhs));
+                    if(not call_res.has_value()) {
+                        return call_res;
+                    }
+                    lhs = std::move(call_res.value());
+                    continue;
+                }
 
-                    return std::unexpected(std::move(error));
+                if(pending.empty()) {
+                    return std::move(lhs);
                 }
 
-                auto end = actual_end_token.getArea();
+                auto operation = std::move(pending.back());
+                pending.pop_back();
+                min_bp = operation.min_bp;
 
-                lhs = build_expr(std::move(lhs), std::move(params), std::move(end));
-                continue;
-            }
+                auto expr_opt = operation.lhs.has_value()
+                    ? build_expr(std::move(operation.lhs.value()), operation.op, std::move(lhs))
+                    : build_expr(operation.op, std::move(lhs));
 
-            // parse infix operators
-            auto bp_opt = infix_binding_power(op.getType());
-            if(not bp_opt.has_value()) {
-                Error error = InternalCompilerError{};
-                return std::unexpected(std::move(error));
+                if(not expr_opt.has_value()) {
+                    Error error = InternalCompilerError{};
+                    return std::unexpected(std::move(error));
+                }
+                lhs = std::move(expr_opt.value());
             }
-            const auto [l_bp, r_bp] = std::move(bp_opt.value());
+        }
+    }
 
-            if(l_bp < min_bp) {
-                break;
-            }
+    // returns the next token if it is an infix operator binding at least as strong as min_bp
+    // nothing is returned for postfix operators, weaker operators or if no operator follows
+    constexpr auto next_operator(std::uint32_t min_bp) noexcept
+        -> std::expected<std::optional<lexing::Token>, common::error::Error>
+    {
+        using common::error::Error;
+        using common::error::InternalCompilerError;
 
-            expr_lexer().pop();
+        if(not expr_lexer().next_is_operator()) {
+            return std::nullopt;
+        }
 
-            auto rhs_res = expression_bp(r_bp);
-            if(not rhs_res.has_value()) {
-                return rhs_res;
-            }
-            auto rhs = std::move(rhs_res.value());
+        const auto op = expr_lexer().peek().value();
+        if(postfix_binding_power(op.getType()).has_value()) {
+            return std::nullopt;
+        }
 
-            auto lhs_opt = build_expr(std::move(lhs), op, std::move(rhs));
-            if(not lhs_opt.has_value()) {
-                Error error = InternalCompilerError{};
-                return std::unexpected(std::move(error));
-            }
-            lhs = std::move(lhs_opt.value());
+        auto bp_opt = infix_binding_power(op.getType());
+        if(not bp_opt.has_value()) {
+            Error error = InternalCompilerError{};
+            return std::unexpected(std::move(error));
         }
 
-        return std::move(lhs);
+        if(bp_opt.value().first < min_bp) {
+            return std::nullopt;
+        }
+
+        return op;
     }
 
-    constexpr auto lhs() noexcept -> std::expected<ast::Expression, common::error::Error>
+    // parses the arguments of a call of callee, the next token is ( or [
+    constexpr auto function_call(ast::Expression&& callee) noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-        using common::error::Error;
-        using common::error::InternalCompilerError;
+        using common::error::UnexpectedToken;
+        using lexing::TokenTypes;
 
-        if(expr_lexer().next_is_prefix_operator()) {
-            auto op = expr_lexer().peek_and_pop().value();
+        const auto op = expr_lexer().peek_and_pop().value();
 
-            auto r_bp_opt = prefix_binding_power(op.getType());
-            if(not r_bp_opt.has_value()) {
-                Error error = InternalCompilerError{};
-                return std::unexpected(std::move(error));
-            }
-            auto r_bp = r_bp_opt.value();
+        auto end_token = op.getType() == TokenTypes::L_BRACKET
+            ? TokenTypes::R_BRACKET
+            : TokenTypes::R_PARANTHESIS;
 
-            auto rhs_res = expression_bp(r_bp);
-            if(not rhs_res.has_value()) {
-                return rhs_res;
-            }
-            auto rhs = std::move(rhs_res.value());
+        auto params_res = function_params(end_token);
+        if(not params_res.has_value()) {
+            return std::unexpected(std::move(params_res.error()));
+        }
+        auto params = std::move(params_res.value());
 
-            auto expr_opt = build_expr(op, std::move(rhs));
+        auto end_token_res = expr_lexer().peek_and_pop();
+        if(not end_token_res.has_value()) {
+            return std::unexpected(std::move(end_token_res.error()));
+        }
+        auto actual_end_token = std::move(end_token_res.value());
 
-            if(not expr_opt.has_value()) {
-                Error error = InternalCompilerError{};
-                return std::unexpected(std::move(error));
-            }
+        if(actual_end_token.getType() != end_token) {
+            UnexpectedToken error{actual_end_token.getType(),
+                                  actual_end_token.getArea(),
+                                  end_token};
 
-            return std::move(expr_opt.value());
+            return std::unexpected(std::move(error));
         }
 
-        return simple_expr();
+        auto end = actual_end_token.getArea();
+
+        return build_expr(std::move(callee), std::move(params), std::move(end));
+    }
+
+    constexpr auto max_nesting_depth() const noexcept -> std::uint32_t
+    {
+        return static_cast<const T*>(this)->max_nesting_depth_;
+    }
+
+    constexpr auto nesting_too_deep(lexing::TextArea area) noexcept -> common::error::Error
+    {
+        return common::error::NestingTooDeep{area, max_nesting_depth()};
+    }
+
+    constexpr auto nesting_too_deep() noexcept -> common::error::Error
+    {
+        return nesting_too_deep(expr_lexer().next_area().value_or(lexing::TextArea{0, 0}));
     }
 
     constexpr auto build_expr(ast::Expression&& lhs, lexing::Token op, ast::Expression&& rhs) noexcept
@@ -190,75 +290,107 @@ private:
         auto area = lexing::TextArea::combine(ast::getTextArea(lhs),
                                               ast::getTextArea(rhs));
 
-        switch(op.getType()) {
+        auto binary_op = binary_operator(op.getType());
+        if(not binary_op.has_value()) {
+            return std::nullopt;
+        }
+
+        return ast::Expression{
+            ast::forward<ast::BinaryOperation>(expr_arena(),
+                                               area,
+                                               binary_op.value(),
+                                               std::move(lhs),
+                                               std::move(rhs))};
+    }
+
+    constexpr auto build_expr(lexing::Token op, ast::Expression&& rhs) noexcept
+        -> std::optional<ast::Expression>
+    {
+        auto area = lexing::TextArea::combine(op.getArea(),
+                                              ast::getTextArea(rhs));
+
+        auto unary_op = unary_operator(op.getType());
+        if(not unary_op.has_value()) {
+            return std::nullopt;
+        }
+
+        return ast::Expression{
+            ast::forward<ast::UnaryOperation>(expr_arena(),
+                                              area,
+                                              unary_op.value(),
+                                              std::move(rhs))};
+    }
+
+    constexpr auto build_expr(ast::Expression&& lhs,
+                              ast::ExpressionList&& params,
+                              lexing::TextArea end) noexcept
+        -> ast::Expression
+    {
+        auto area = lexing::TextArea::combine(ast::getTextArea(lhs),
+                                              end);
+        return ast::Expression{
+            ast::forward<ast::FunctionCall>(expr_arena(),
+                                            area,
+                                            std::move(lhs),
+                                            std::move(params))};
+    }
+
+    constexpr static auto binary_operator(lexing::TokenTypes t) noexcept
+        -> std::optional<ast::BinaryOperator>
+    {
+        switch(t) {
         case lexing::TokenTypes::PLUS:
-            return ast::Expression{ast::forward<ast::Addition>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::ADDITION;
         case lexing::TokenTypes::MINUS:
-            return ast::Expression{ast::forward<ast::Substraction>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::SUBSTRACTION;
         case lexing::TokenTypes::ASTERIX:
-            return ast::Expression{ast::forward<ast::Multiplication>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::MULTIPLICATION;
         case lexing::TokenTypes::DIVISION:
-            return ast::Expression{ast::forward<ast::Division>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::DIVISION;
         case lexing::TokenTypes::PERCENT:
-            return ast::Expression{ast::forward<ast::Remainder>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::REMAINDER;
         case lexing::TokenTypes::LOGICAL_OR:
-            return ast::Expression{ast::forward<ast::LogicalOr>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::LOGICAL_OR;
         case lexing::TokenTypes::LOGICAL_AND:
-            return ast::Expression{ast::forward<ast::LogicalAnd>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::LOGICAL_AND;
         case lexing::TokenTypes::BITWISE_OR:
-            return ast::Expression{ast::forward<ast::BitwiseOr>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::BITWISE_OR;
         case lexing::TokenTypes::BITWISE_AND:
-            return ast::Expression{ast::forward<ast::BitwiseAnd>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::BITWISE_AND;
         case lexing::TokenTypes::LT:
-            return ast::Expression{ast::forward<ast::LessThen>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::LESS_THEN;
         case lexing::TokenTypes::LE:
-            return ast::Expression{ast::forward<ast::LessEqThen>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::LESS_EQ_THEN;
         case lexing::TokenTypes::GT:
-            return ast::Expression{ast::forward<ast::GreaterThen>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::GREATER_THEN;
         case lexing::TokenTypes::GE:
-            return ast::Expression{ast::forward<ast::GreaterEqThen>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::GREATER_EQ_THEN;
         case lexing::TokenTypes::EQ:
-            return ast::Expression{ast::forward<ast::Equal>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::EQUAL;
         case lexing::TokenTypes::NEQ:
-            return ast::Expression{ast::forward<ast::NotEqual>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::NOT_EQUAL;
         case lexing::TokenTypes::DOT:
-            return ast::Expression{ast::forward<ast::MemberAccess>(area, std::move(lhs), std::move(rhs))};
+            return ast::BinaryOperator::MEMBER_ACCESS;
         default:
             return std::nullopt;
         }
     }
 
-    constexpr auto build_expr(lexing::Token op, ast::Expression&& rhs) noexcept
-        -> std::optional<ast::Expression>
+    constexpr static auto unary_operator(lexing::TokenTypes t) noexcept
+        -> std::optional<ast::UnaryOperator>
     {
-        auto area = lexing::TextArea::combine(op.getArea(),
-                                              ast::getTextArea(rhs));
-
-        switch(op.getType()) {
+        switch(t) {
         case lexing::TokenTypes::PLUS:
-            return ast::Expression{ast::forward<ast::UnaryPlus>(area, std::move(rhs))};
+            return ast::UnaryOperator::PLUS;
         case lexing::TokenTypes::MINUS:
-            return ast::Expression{ast::forward<ast::UnaryMinus>(area, std::move(rhs))};
+            return ast::UnaryOperator::MINUS;
         case lexing::TokenTypes::LOGICAL_NOT:
-            return ast::Expression{ast::forward<ast::LogicalNot>(area, std::move(rhs))};
+            return ast::UnaryOperator::LOGICAL_NOT;
         default:
             return std::nullopt;
         }
     }
 
-    constexpr auto build_expr(ast::Expression&& lhs,
-                              std::vector<ast::Expression>&& params,
-                              lexing::TextArea end) noexcept
-        -> ast::Expression
-    {
-        auto area = lexing::TextArea::combine(ast::getTextArea(lhs),
-                                              end);
-        return ast::Expression{
-            ast::forward<ast::FunctionCall>(area,
-                                            std::move(lhs),
-                                            std::move(params))};
-    }
-
     constexpr static auto infix_binding_power(lexing::TokenTypes t) noexcept
         -> std::optional<std::pair<std::uint32_t, std::uint32_t>>
     {
@@ -328,11 +460,16 @@ private:
     }
 
 private:
-    constexpr auto expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto expr_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
 
+    constexpr auto expr_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
+
     constexpr auto simple_expr() noexcept
         -> std::expected<ast::Expression, common::error::Error>
     {
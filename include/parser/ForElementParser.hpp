@@ -2,7 +2,9 @@
 
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -18,14 +20,14 @@ template<class T>
 class ForElementParser
 {
 public:
-    constexpr auto for_element() noexcept -> std::optional<ast::ForElement>
+    constexpr auto for_element() noexcept
+        -> std::expected<ast::ForElement, common::error::Error>
     {
-        auto id_opt = static_cast<T*>(this)->identifier();
-        if(not id_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto id_res = static_cast<T*>(this)->identifier();
+        if(not id_res.has_value()) {
+            return std::unexpected(std::move(id_res.error()));
         }
-        auto id = std::move(id_opt.value());
+        auto id = std::move(id_res.value());
 
         if(for_element_lexer().next_is(lexing::TokenTypes::L_ARROW)) {
             return monadic_for_element(std::move(id));
@@ -35,25 +37,25 @@ public:
             return let_for_element(std::move(id));
         }
 
-        // return "expected <- or =" error
-        return std::nullopt;
+        return std::unexpected(unexpected_next_token(for_element_lexer(),
+                                                     lexing::TokenTypes::L_ARROW,
+                                                     lexing::TokenTypes::ASSIGN));
     }
 
     constexpr auto monadic_for_element(ast::Identifier&& id) noexcept
-        -> std::optional<ast::ForMonadicElement>
+        -> std::expected<ast::ForMonadicElement, common::error::Error>
     {
         // sanity check
         if(not for_element_lexer().pop_next_is(lexing::TokenTypes::L_ARROW)) {
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(for_element_lexer(), lexing::TokenTypes::L_ARROW));
         }
 
-        auto rhs_opt = static_cast<T*>(this)->expression();
-        if(not rhs_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto rhs_res = static_cast<T*>(this)->expression();
+        if(not rhs_res.has_value()) {
+            return std::unexpected(std::move(rhs_res.error()));
         }
 
-        auto rhs = std::move(rhs_opt.value());
+        auto rhs = std::move(rhs_res.value());
         auto start = id.getArea();
         auto end = ast::getTextArea(rhs);
         auto area = lexing::TextArea::combine(start, end);
@@ -64,20 +66,19 @@ public:
     }
 
     constexpr auto let_for_element(ast::Identifier&& id) noexcept
-        -> std::optional<ast::ForLetElement>
+        -> std::expected<ast::ForLetElement, common::error::Error>
     {
         // sanity check
         if(not for_element_lexer().pop_next_is(lexing::TokenTypes::ASSIGN)) {
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(for_element_lexer(), lexing::TokenTypes::ASSIGN));
         }
 
-        auto rhs_opt = static_cast<T*>(this)->expression();
-        if(not rhs_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto rhs_res = static_cast<T*>(this)->expression();
+        if(not rhs_res.has_value()) {
+            return std::unexpected(std::move(rhs_res.error()));
         }
 
-        auto rhs = std::move(rhs_opt.value());
+        auto rhs = std::move(rhs_res.value());
         auto start = id.getArea();
         auto end = ast::getTextArea(rhs);
         auto area = lexing::TextArea::combine(start, end);
@@ -88,7 +89,7 @@ public:
     }
 
 private:
-    constexpr auto for_element_lexer() noexcept -> lexing::Lexer&
+    constexpr auto for_element_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
@@ -3,10 +3,11 @@
 #include <ast/common/Identifier.hpp>
 #include <ast/Ast.hpp>
 #include <common/Error.hpp>
+#include <common/Interner.hpp>
 #include <exception>
 #include <expected>
 #include <functional>
-#include <lexer/Lexer.hpp>
+#include <lexer/TokenCursor.hpp>
 #include <lexer/Tokens.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -33,7 +34,7 @@ public:
 
         if(token.getType() == TokenTypes::IDENTIFIER) {
             identifier_lexer().pop();
-            return Identifier{token.getArea(), token.getValue()};
+            return Identifier{token.getArea(), token.getValue(identifier_content()), identifier_interner()};
         }
 
         UnexpectedToken error{token.getType(),
@@ -43,9 +44,20 @@ public:
     }
 
 private:
-    constexpr auto identifier_lexer() noexcept -> lexing::Lexer&
+    constexpr auto identifier_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto identifier_content() const noexcept -> std::string_view
+    {
+        return static_cast<const T*>(this)->content_;
+    }
+
+    auto identifier_interner() noexcept -> common::Interner&
+    {
+        auto* interner = static_cast<T*>(this)->interner_;
+        return interner != nullptr ? *interner : common::Interner::global();
+    }
 };
 } // namespace parser
@@ -2,7 +2,9 @@
 
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -14,68 +16,63 @@ template<class T>
 class IfExpressionParser
 {
 public:
-    constexpr auto if_expression() noexcept -> std::optional<ast::Expression>
+    constexpr auto if_expression() noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-        if(not if_expr_lexer().next_is(lexing::TokenTypes::IF)) {
-            return std::nullopt;
+        using lexing::TokenTypes;
+
+        if(not if_expr_lexer().next_is(TokenTypes::IF)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::IF));
         }
 
         auto start = if_expr_lexer().peek_and_pop().value().getArea();
 
-        if(not if_expr_lexer().pop_next_is(lexing::TokenTypes::L_PARANTHESIS)) {
-            // TODO: return error "expected ("
-            return std::nullopt;
+        if(not if_expr_lexer().pop_next_is(TokenTypes::L_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::L_PARANTHESIS));
         }
 
-        auto if_condition_opt = static_cast<T*>(this)->expression();
-        if(not if_condition_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto if_condition_res = static_cast<T*>(this)->expression();
+        if(not if_condition_res.has_value()) {
+            return std::unexpected(std::move(if_condition_res.error()));
         }
-        auto if_condition = std::move(if_condition_opt.value());
+        auto if_condition = std::move(if_condition_res.value());
 
 
-        if(not if_expr_lexer().pop_next_is(lexing::TokenTypes::R_PARANTHESIS)) {
-            // TODO: return error "expected )"
-            return std::nullopt;
+        if(not if_expr_lexer().pop_next_is(TokenTypes::R_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::R_PARANTHESIS));
         }
 
-        auto if_block_expr_opt = static_cast<T*>(this)->expression();
-        if(not if_block_expr_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto if_block_expr_res = static_cast<T*>(this)->expression();
+        if(not if_block_expr_res.has_value()) {
+            return std::unexpected(std::move(if_block_expr_res.error()));
         }
-        auto if_block_expr = std::move(if_block_expr_opt.value());
+        auto if_block_expr = std::move(if_block_expr_res.value());
 
         std::vector<ast::ElifExpr> elifs;
-        while(if_expr_lexer().next_is(lexing::TokenTypes::ELIF)) {
-            auto elif_expr = elif_expression();
-
-            if(not elif_expr.has_value()) {
-                // TODO: propagate error
-                return std::nullopt;
+        while(if_expr_lexer().next_is(TokenTypes::ELIF)) {
+            auto elif_expr_res = elif_expression();
+            if(not elif_expr_res.has_value()) {
+                return std::unexpected(std::move(elif_expr_res.error()));
             }
 
-            elifs.emplace_back(std::move(elif_expr.value()));
+            elifs.emplace_back(std::move(elif_expr_res.value()));
         }
 
-        if(not if_expr_lexer().pop_next_is(lexing::TokenTypes::ELSE)) {
-            // TODO: reutrn "exprected else keyword here"
-
-            return std::nullopt;
+        if(not if_expr_lexer().pop_next_is(TokenTypes::ELSE)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::ELIF, TokenTypes::ELSE));
         }
 
-        auto else_block_opt = static_cast<T*>(this)->expression();
-        if(not else_block_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto else_block_res = static_cast<T*>(this)->expression();
+        if(not else_block_res.has_value()) {
+            return std::unexpected(std::move(else_block_res.error()));
         }
-        auto else_block = std::move(else_block_opt.value());
+        auto else_block = std::move(else_block_res.value());
 
         auto end = ast::getTextArea(else_block);
 
         return ast::Expression{
-            ast::forward<ast::IfExpr>(lexing::TextArea::combine(start, end),
+            ast::forward<ast::IfExpr>(if_expr_arena(),
+                                      lexing::TextArea::combine(start, end),
                                       std::move(if_condition),
                                       std::move(if_block_expr),
                                       std::move(elifs),
@@ -83,37 +80,36 @@ public:
     }
 
 private:
-    constexpr auto elif_expression() noexcept -> std::optional<ast::ElifExpr>
+    constexpr auto elif_expression() noexcept
+        -> std::expected<ast::ElifExpr, common::error::Error>
     {
-        if(not if_expr_lexer().next_is(lexing::TokenTypes::ELIF)) {
-            return std::nullopt;
+        using lexing::TokenTypes;
+
+        if(not if_expr_lexer().next_is(TokenTypes::ELIF)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::ELIF));
         }
 
         auto start = if_expr_lexer().peek_and_pop().value().getArea();
 
-        if(not if_expr_lexer().pop_next_is(lexing::TokenTypes::L_PARANTHESIS)) {
-            // TODO: return error "expected ("
-            return std::nullopt;
+        if(not if_expr_lexer().pop_next_is(TokenTypes::L_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::L_PARANTHESIS));
         }
 
-        auto elif_condition_opt = static_cast<T*>(this)->expression();
-        if(not elif_condition_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto elif_condition_res = static_cast<T*>(this)->expression();
+        if(not elif_condition_res.has_value()) {
+            return std::unexpected(std::move(elif_condition_res.error()));
         }
-        auto elif_condition = std::move(elif_condition_opt.value());
+        auto elif_condition = std::move(elif_condition_res.value());
 
-        if(not if_expr_lexer().pop_next_is(lexing::TokenTypes::R_PARANTHESIS)) {
-            // TODO: return error "expected )"
-            return std::nullopt;
+        if(not if_expr_lexer().pop_next_is(TokenTypes::R_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(if_expr_lexer(), TokenTypes::R_PARANTHESIS));
         }
 
-        auto block_expr_opt = static_cast<T*>(this)->expression();
-        if(not block_expr_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto block_expr_res = static_cast<T*>(this)->expression();
+        if(not block_expr_res.has_value()) {
+            return std::unexpected(std::move(block_expr_res.error()));
         }
-        auto block_expr = std::move(block_expr_opt.value());
+        auto block_expr = std::move(block_expr_res.value());
 
         auto end = ast::getTextArea(block_expr);
 
@@ -123,10 +119,15 @@ private:
     }
 
 private:
-    constexpr auto if_expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto if_expr_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto if_expr_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 
 } // namespace parser
@@ -1,12 +1,15 @@
 #pragma once
 
-#include <algorithm>
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
+#include <optional>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
+#include <vector>
 
 namespace parser {
 
@@ -17,318 +20,186 @@ template<class T>
 class LParExpressionParser
 {
 public:
-    constexpr auto l_par_expression() noexcept -> std::optional<ast::Expression>
+    constexpr auto l_par_expression() noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-        if(not lpar_expr_lexer().next_is(lexing::TokenTypes::L_PARANTHESIS)) {
-            return std::nullopt;
+        using lexing::TokenTypes;
+
+        if(not lpar_expr_lexer().next_is(TokenTypes::L_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(lpar_expr_lexer(), TokenTypes::L_PARANTHESIS));
         }
 
         auto start = lpar_expr_lexer().peek_and_pop().value().getArea();
 
-        // parse the first expression after the ( because thats what all the three options
-        // what it could be have in common
-        auto expr_opt = static_cast<T*>(this)->expression();
-        if(not expr_opt) {
-            // TODO: propagate error
-            return std::nullopt;
-        }
-        auto expr = std::move(expr_opt.value());
-
-        // if the next token is ) then it was a grouped expression or a lambda
-        if(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::R_PARANTHESIS)) {
-            // check if it could be a lambda otherwise return the expr itself
-            return try_lambda(start, std::move(expr));
+        // first try to parse the head of a lambda expression "(a, b: Int) =>"
+        // if the tokens after the ( do not form one, rewind and parse a grouped expression or tuple instead.
+        // this way expressions are never parsed just to be converted to lambda parameters afterwards
+        const auto checkpoint = lpar_expr_lexer().checkpoint();
+        if(auto parameters_opt = lambda_head()) {
+            return lambda(start, std::move(parameters_opt.value()));
         }
+        lpar_expr_lexer().rewind(checkpoint);
 
-        // TODO: if next token is a : then it is a lambda expression
-
-        // if next token is a , then we have (<expr>, which coule be a lambda expression "(a, b) => c" or a tuple (a, b)
-        if(lpar_expr_lexer().next_is(lexing::TokenTypes::COMMA)) {
-
-            // try parsing a tuple or a lambda expression from the expressions lists
-            auto res = tuple_or_lambda_params(start, std::move(expr));
-
-            return std::visit(
-                [this, start = start](auto&& r) -> std::optional<ast::Expression> {
-                    if constexpr(std::same_as<std::nullopt_t, std::decay_t<decltype(r)>>) {
-                        return std::nullopt;
-                    } else {
-                        // r can be a list of parameters or a tuple
-                        // if it is a list of parameters, it is clear that it is a lambda expression
-                        // but if it is a tuple, it can still be a lambda expression when it is followed by a =>
-                        return try_lambda(start, std::move(r));
-                    }
-                },
-                std::move(res));
+        auto expr_res = static_cast<T*>(this)->expression();
+        if(not expr_res.has_value()) {
+            return std::unexpected(std::move(expr_res.error()));
         }
+        auto expr = std::move(expr_res.value());
 
-        // TODO: return error "expected ) or : or ,"
-        return std::nullopt;
-    }
-
-private:
-    // given a list of exprssions, this method checks if all the expressions are identifiers
-    // and if so it converts them to a lits of lambda parameters
-    constexpr auto exprs_to_parameters(std::vector<ast::Expression>&& parsed) noexcept
-        -> std::optional<std::vector<ast::LambdaParameter>>
-    {
-        for(const auto& elem : parsed) {
-            if(not std::holds_alternative<ast::Identifier>(elem)) {
-                // TODO: return error "elem" should be an identifier and not an ...
-                return std::nullopt;
+        // if the next token is ) then it was a grouped expression
+        if(lpar_expr_lexer().next_is(TokenTypes::R_PARANTHESIS)) {
+            auto end = lpar_expr_lexer().peek_and_pop().value().getArea();
+            if(followed_by_lambda_arrow()) {
+                return std::unexpected(common::error::InvalidLambdaParameter{lexing::TextArea::combine(start, end)});
             }
+            return std::move(expr);
         }
 
+        if(lpar_expr_lexer().next_is(TokenTypes::COMMA)) {
+            return tuple(start, std::move(expr));
+        }
 
-        std::vector<ast::LambdaParameter> parameters;
-        parameters.reserve(parsed.size());
-
-        std::transform(std::make_move_iterator(std::begin(parsed)),
-                       std::make_move_iterator(std::end(parsed)),
-                       std::back_inserter(parameters),
-                       [](auto&& expr) {
-                           auto id = std::move(std::get<ast::Identifier>(expr));
-                           return ast::LambdaParameter{std::move(id)};
-                       });
-
-        return std::move(parameters);
+        return std::unexpected(unexpected_next_token(lpar_expr_lexer(), TokenTypes::R_PARANTHESIS, TokenTypes::COMMA));
     }
 
-    // parse a lambda parameter <id> (: <type>)?
-    constexpr auto lambda_parameter() noexcept -> std::optional<ast::LambdaParameter>
+private:
+    // checks if the next two tokens can start a lambda parameter list
+    // such that most grouped expressions and tuples are not parsed twice
+    constexpr auto may_start_lambda_head() noexcept -> bool
     {
-        auto id_opt = static_cast<T*>(this)->identifier();
-        if(not id_opt.has_value()) {
-            // TODO: propagte error
-            return std::nullopt;
+        if(not lpar_expr_lexer().next_is(lexing::TokenTypes::IDENTIFIER)) {
+            return false;
         }
-        auto id = std::move(id_opt.value());
 
-        if(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COLON)) {
-            auto type_opt = static_cast<T*>(this)->type();
-            if(not type_opt.has_value()) {
-                // TODO: propagte error
-                return std::nullopt;
-            }
-            auto type = std::move(type_opt.value());
-
-            return ast::LambdaParameter{std::move(id), std::move(type)};
+        auto second = lpar_expr_lexer().lookahead(1);
+        if(not second.has_value()) {
+            return false;
         }
-        return ast::LambdaParameter{std::move(id)};
-    }
-
-    // parse a lambda parameter which is a simple identifier or "id: <type>" given the id is already parsed
-    // and the start is at the colon right before the type
-    constexpr auto lambda_parameter(ast::Identifier&& id) noexcept -> std::optional<ast::LambdaParameter>
-    {
-        if(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COLON)) {
-            auto type_opt = static_cast<T*>(this)->type();
-            if(not type_opt.has_value()) {
-                // TODO: propagte error
-                return std::nullopt;
-            }
-            auto type = std::move(type_opt.value());
 
-            return ast::LambdaParameter{std::move(id), std::move(type)};
-        }
-        return ast::LambdaParameter{std::move(id)};
+        const auto type = second.value().getType();
+        return type == lexing::TokenTypes::COMMA
+            or type == lexing::TokenTypes::COLON
+            or type == lexing::TokenTypes::R_PARANTHESIS;
     }
 
-    // when parsing a tuple and we have a list of already parsed expressions and then at a point the next expression is <expr>:<type>
-    // it is known that the tuple wasnt realy a tuple but a lambda parameter list
-    // this method starts right at the first colon
-    // it extracts all the already parsed expressions, checks if they are identifiers and if to assignes the type after the first colon
-    // to the last parsed identifier
-    // then it continues to parse the list of lambda parameters
-    constexpr auto lambda_parameters_from_starting_tuple(std::vector<ast::Expression>&& parsed) noexcept
-        -> std::optional<std::vector<ast::LambdaParameter>>
+    // parse "<param> (, <param>)* ) =>" right after the (
+    // returns nothing if the tokens are not the head of a lambda expression,
+    // in this case the caller has to rewind the lexer
+    constexpr auto lambda_head() noexcept -> std::optional<ast::LambdaParameterList>
     {
-        // sanity check
-        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COLON)) {
-            // TODO: log something
-            return std::nullopt;
-        }
-
-        auto type_opt = static_cast<T*>(this)->type();
-        if(not type_opt.has_value()) {
-            // TODO: propagte error
+        if(not may_start_lambda_head()) {
             return std::nullopt;
         }
-        auto type = std::move(type_opt.value());
 
-        auto params_opt = exprs_to_parameters(std::move(parsed));
-        if(not params_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
-        }
-        auto params = std::move(params_opt.value());
-
-        params.back().setType(std::move(type));
+        ast::LambdaParameterList parameters;
 
-        while(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COMMA)) {
+        do {
             auto param_opt = lambda_parameter();
             if(not param_opt.has_value()) {
                 return std::nullopt;
             }
+            parameters.emplace_back(std::move(param_opt.value()));
+        } while(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COMMA));
 
-            params.emplace_back(std::move(param_opt.value()));
-        }
-
-        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::R_PARANTHESIS)) {
-            // TODO: return "expected ) error"
+        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::R_PARANTHESIS)
+           or not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
             return std::nullopt;
         }
 
-        return std::make_optional(std::move(params));
+        return std::move(parameters);
     }
 
-    // given (<expr> we try to parse a tuple or a lambda parameter list here
-    // when in any case there is a "id : type" pattern in the parsing then it musst be a lambda parameter list
-    // if it is just a lits of expressions without type annotation then it musst be a tuple
-    constexpr auto tuple_or_lambda_params(lexing::TextArea start, ast::Expression&& first) noexcept
-        -> std::variant<ast::TupleExpr,
-                        std::vector<ast::LambdaParameter>,
-                        std::nullopt_t>
+    // parse a lambda parameter <id> (: <type>)?
+    // returns nothing if the tokens are no lambda parameter, the errors are dropped
+    // because the caller rewinds and parses a grouped expression or tuple instead
+    constexpr auto lambda_parameter() noexcept -> std::optional<ast::LambdaParameter>
     {
-        std::vector<ast::Expression> expressions;
-        expressions.emplace_back(std::move(first));
-
-        while(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COMMA)) {
-            auto expr_opt = static_cast<T*>(this)->expression();
-            if(not expr_opt) {
-                // TODO: propagate error
-                return std::nullopt;
-            }
-            auto expr = std::move(expr_opt.value());
-            expressions.emplace_back(std::move(expr));
+        auto id_res = static_cast<T*>(this)->identifier();
+        if(not id_res.has_value()) {
+            return std::nullopt;
         }
+        auto id = std::move(id_res.value());
 
-        // do not pop the colon
-        if(lpar_expr_lexer().next_is(lexing::TokenTypes::COLON)) {
-            auto params_opt = lambda_parameters_from_starting_tuple(std::move(expressions));
-            if(not params_opt.has_value()) {
+        if(lpar_expr_lexer().pop_next_is(lexing::TokenTypes::COLON)) {
+            auto type_res = static_cast<T*>(this)->type();
+            if(not type_res.has_value()) {
                 return std::nullopt;
             }
-            return std::move(params_opt.value());
-        }
+            auto type = std::move(type_res.value());
 
-        if(not lpar_expr_lexer().next_is(lexing::TokenTypes::R_PARANTHESIS)) {
-            // TODO: return "expected ) error"
-            return std::nullopt;
+            return ast::LambdaParameter{std::move(id), std::move(type)};
         }
-
-        auto end = lpar_expr_lexer().peek_and_pop().value().getArea();
-        auto area = lexing::TextArea::combine(start, end);
-
-        return ast::TupleExpr{area, std::move(expressions)};
+        return ast::LambdaParameter{std::move(id)};
     }
 
-
-    // given a list of lambda parameters such as (a: Int, b, c: Int) it musst be a lambda expression and therefore be followed by a => token
-    // consume this token, parse the body and return the lambda expression
-    constexpr auto try_lambda(lexing::TextArea start, std::vector<ast::LambdaParameter>&& parameters) noexcept
-        -> std::optional<ast::Expression>
+    // a grouped expression or tuple followed by => would be a lambda whose parameters are not all identifiers
+    constexpr auto followed_by_lambda_arrow() noexcept -> bool
     {
-        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            // TODO: return error "expected =>"
-            return std::nullopt;
-        }
-
-        auto body_opt = static_cast<T*>(this)->expression();
-        if(not body_opt.has_value()) {
-            return std::nullopt;
-        }
-        auto body = std::move(body_opt.value());
-        auto end = ast::getTextArea(body);
-        auto area = lexing::TextArea::combine(start, end);
-
-        return ast::Expression{
-            ast::forward<ast::LambdaExpr>(area,
-                                          std::move(parameters),
-                                          std::move(body))};
+        return lpar_expr_lexer().next_is(lexing::TokenTypes::LAMBDA_ARROW);
     }
 
-    // given a parsed tuple expression it could be the case that this is a lambda expression
-    // to this be the case the tuple expression needs to be followed by a => token
-    // if this is the case it is a lambda expression and all the expressions in the tuple need to be identifiers
-    // if the tuple is not followed by a => token we just return the tuple itself, because it is just a tuple and not an lambda expression
-    constexpr auto try_lambda(lexing::TextArea start, ast::TupleExpr&& tuple) noexcept
-        -> std::optional<ast::Expression>
+    // given (<expr> and the next token being a , parse the rest of the tuple
+    constexpr auto tuple(lexing::TextArea start, ast::Expression&& first) noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-        // if the next identifier is not a lambda arrow then the expression was realy a tuple expression
-        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            return ast::Expression{
-                ast::forward<ast::TupleExpr>(std::move(tuple))};
+        using lexing::TokenTypes;
+
+        std::vector<ast::Expression> expressions;
+        expressions.emplace_back(std::move(first));
+
+        while(lpar_expr_lexer().pop_next_is(TokenTypes::COMMA)) {
+            auto expr_res = static_cast<T*>(this)->expression();
+            if(not expr_res.has_value()) {
+                return std::unexpected(std::move(expr_res.error()));
+            }
+            expressions.emplace_back(std::move(expr_res.value()));
         }
 
-        // parse the body of the lambda expression
-        auto body_opt = static_cast<T*>(this)->expression();
-        if(not body_opt.has_value()) {
-            return std::nullopt;
+        if(not lpar_expr_lexer().next_is(TokenTypes::R_PARANTHESIS)) {
+            return std::unexpected(unexpected_next_token(lpar_expr_lexer(), TokenTypes::R_PARANTHESIS, TokenTypes::COMMA));
         }
-        auto body = std::move(body_opt.value());
 
-        // calculate the area of the lambda expression
-        auto end = ast::getTextArea(body);
+        auto end = lpar_expr_lexer().peek_and_pop().value().getArea();
         auto area = lexing::TextArea::combine(start, end);
 
-        // move expressions out of the tuple
-        auto exprs = std::move(tuple.getExpressions());
-
-        // check if all expressions are identifiers
-        auto param_opt = exprs_to_parameters(std::move(exprs));
-        if(not param_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        if(followed_by_lambda_arrow()) {
+            return std::unexpected(common::error::InvalidLambdaParameter{area});
         }
-        auto parameters = std::move(param_opt.value());
 
         return ast::Expression{
-            ast::forward<ast::LambdaExpr>(area,
-                                          std::move(parameters),
-                                          std::move(body))};
+            ast::forward<ast::TupleExpr>(lpar_expr_arena(),
+                                         area,
+                                         std::move(expressions))};
     }
-    // given an expression after a (expr)=> we try to parse a lambda here
-    // for this to be a valid lambda, the expression needs to be a parameter which means it needs to be an Identifier
-    // if that is true we parse the => followed by the lambda body
-    // if the expr in (<expresssion>) is not followed by a => it is only a grouped expression and we return the simple expression again
-    constexpr auto try_lambda(lexing::TextArea start, ast::Expression&& first) noexcept
-        -> std::optional<ast::Expression>
-    {
-        // if the next identifier is not a lambda arrow then the expression was realy a tuple expression
-        if(not lpar_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
-            return std::move(first);
-        }
 
-        auto body_opt = static_cast<T*>(this)->expression();
-        if(not body_opt.has_value()) {
-            return std::nullopt;
+    // given the already parsed head of a lambda expression (a: Int, b) => parse its body
+    constexpr auto lambda(lexing::TextArea start, ast::LambdaParameterList&& parameters) noexcept
+        -> std::expected<ast::Expression, common::error::Error>
+    {
+        auto body_res = static_cast<T*>(this)->expression();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto body = std::move(body_opt.value());
-
+        auto body = std::move(body_res.value());
         auto end = ast::getTextArea(body);
         auto area = lexing::TextArea::combine(start, end);
 
-        std::vector<ast::Expression> exprs;
-        exprs.emplace_back(std::move(first));
-
-        auto param_opt = exprs_to_parameters(std::move(exprs));
-        if(not param_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
-        }
-        auto parameters = std::move(param_opt.value());
-
         return ast::Expression{
-            ast::forward<ast::LambdaExpr>(area,
+            ast::forward<ast::LambdaExpr>(lpar_expr_arena(),
+                                          area,
                                           std::move(parameters),
                                           std::move(body))};
     }
 
 private:
-    constexpr auto lpar_expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto lpar_expr_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto lpar_expr_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 } // namespace parser
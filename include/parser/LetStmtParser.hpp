@@ -5,7 +5,7 @@
 #include <ast/Forward.hpp>
 #include <common/Error.hpp>
 #include <exception>
-#include <lexer/Lexer.hpp>
+#include <lexer/TokenCursor.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -82,17 +82,23 @@ public:
         auto area = lexing::TextArea::combine(start, end);
 
         return ast::Statement{
-            ast::forward<ast::LetAssignment>(area,
+            ast::forward<ast::LetAssignment>(let_stmt_arena(),
+                                             area,
                                              std::move(id),
                                              std::move(t),
                                              std::move(rhs))};
     }
 
 private:
-    constexpr auto let_stmt_lexer() noexcept -> lexing::Lexer&
+    constexpr auto let_stmt_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto let_stmt_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 
 } // namespace parser
@@ -0,0 +1,166 @@
+#pragma once
+
+#include <algorithm>
+#include <ast/Arena.hpp>
+#include <ast/Ast.hpp>
+#include <common/Error.hpp>
+#include <cstdint>
+#include <expected>
+#include <iterator>
+#include <lexer/ParallelLexer.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/Tokens.hpp>
+#include <parser/Parser.hpp>
+#include <parser/ToplevelParser.hpp>
+#include <string_view>
+#include <tbb/parallel_for.h>
+#include <tbb/task_arena.h>
+#include <utility>
+#include <vector>
+
+// parsing of large sources in parallel.
+// top level elements do not depend on each other, so the token stream is split
+// into segments of whole top level elements which are parsed independently.
+// the starts of the elements are found in one pass over the token types.
+// every segment is parsed by its own parser into its own arena and the elements
+// are concatenated in source order afterwards
+namespace parser {
+
+namespace detail {
+
+// segments with fewer tokens than this are not worth the overhead of parsing them in parallel
+constexpr std::size_t min_parallel_segment_tokens = 16 * 1024;
+
+// returns the index of the first token of every segment followed by the number of tokens
+// segments only start at top level elements and contain about the same number of tokens
+inline auto split_into_segments(const lexing::TokenBuffer& tokens, std::size_t segment_count) noexcept
+    -> std::vector<std::uint32_t>
+{
+    const auto& types = tokens.getTypes();
+    const auto target = types.size() / std::max(segment_count, std::size_t{1});
+
+    std::vector<std::uint32_t> boundaries{0};
+    ToplevelBoundaries toplevel_boundaries;
+
+    for(std::uint32_t i = 0; i < types.size(); i++) {
+        if(toplevel_boundaries.starts_element(types[i])
+           and i - boundaries.back() >= target and i > 0) {
+            boundaries.emplace_back(i);
+        }
+    }
+
+    boundaries.emplace_back(types.size());
+    return boundaries;
+}
+
+// copies the tokens of the segment [begin, end) into their own buffer
+// which ends with an END_OF_FILE token placed where the next segment starts
+inline auto segment_tokens(const lexing::TokenBuffer& tokens, std::uint32_t begin, std::uint32_t end) noexcept
+    -> lexing::TokenBuffer
+{
+    lexing::TokenBuffer segment;
+    segment.reserve(end - begin + 1);
+    segment.append(tokens, begin, end);
+
+    if(end < tokens.size()) {
+        segment.push_back(lexing::Token{lexing::TokenTypes::END_OF_FILE, tokens.getOffset(end), 0});
+    }
+
+    return segment;
+}
+
+} // namespace detail
+
+// the top level elements of a source parsed in parallel
+// every segment allocates its nodes in its own arena, the arenas are owned by the module
+// such that the elements are valid as long as the module lives
+class ParsedModule
+{
+public:
+    ParsedModule(std::vector<ast::Arena>&& arenas,
+                 std::vector<ast::ToplevelElement>&& elements) noexcept
+        : arenas_(std::move(arenas)),
+          elements_(std::move(elements)) {}
+
+    auto getElements() const noexcept -> const std::vector<ast::ToplevelElement>&
+    {
+        return elements_;
+    }
+    auto getElements() noexcept -> std::vector<ast::ToplevelElement>&
+    {
+        return elements_;
+    }
+
+    auto getSegmentCount() const noexcept -> std::size_t
+    {
+        return arenas_.size();
+    }
+
+private:
+    // declared first such that the elements are dropped before their arenas
+    std::vector<ast::Arena> arenas_;
+    std::vector<ast::ToplevelElement> elements_;
+};
+
+// parses the tokens of source split into at most segment_count segments in parallel
+// the elements are the same as the ones of Parser::toplevel, if parsing fails
+// the error of the first failing segment is returned
+inline auto parse_parallel(std::string_view source,
+                           lexing::TokenBuffer tokens,
+                           std::size_t segment_count) noexcept
+    -> std::expected<ParsedModule, common::error::Error>
+{
+    // a lexer error has to be reported after all parse errors in front of it,
+    // so such sources are parsed as a whole
+    if(segment_count <= 1 or tokens.hasError()) {
+        std::vector<ast::Arena> arenas(1);
+        auto result = Parser{source, std::move(tokens), arenas.front()}.toplevel();
+        if(not result.has_value()) {
+            return std::unexpected(std::move(result.error()));
+        }
+        return ParsedModule{std::move(arenas), std::move(result.value())};
+    }
+
+    const auto boundaries = detail::split_into_segments(tokens, segment_count);
+    const auto segments = boundaries.size() - 1;
+
+    std::vector<ast::Arena> arenas(segments);
+    std::vector<std::expected<std::vector<ast::ToplevelElement>, common::error::Error>> results(segments);
+
+    tbb::parallel_for(std::size_t{0}, segments, [&](std::size_t i) {
+        auto segment = detail::segment_tokens(tokens, boundaries[i], boundaries[i + 1]);
+        results[i] = Parser{source, std::move(segment), arenas[i]}.toplevel();
+    });
+
+    std::size_t element_count = 0;
+    for(auto& result : results) {
+        if(not result.has_value()) {
+            return std::unexpected(std::move(result.error()));
+        }
+        element_count += result.value().size();
+    }
+
+    std::vector<ast::ToplevelElement> elements;
+    elements.reserve(element_count);
+    for(auto& result : results) {
+        auto& segment_elements = result.value();
+        std::move(segment_elements.begin(), segment_elements.end(), std::back_inserter(elements));
+    }
+
+    return ParsedModule{std::move(arenas), std::move(elements)};
+}
+
+// lexes and parses source in parallel with one segment per thread of the current task arena
+// small sources are split into fewer segments or parsed serially
+inline auto parse_parallel(std::string_view source) noexcept
+    -> std::expected<ParsedModule, common::error::Error>
+{
+    auto tokens = lexing::tokenize_parallel(source);
+
+    const auto threads = static_cast<std::size_t>(tbb::this_task_arena::max_concurrency());
+    const auto segment_count = std::min(threads, tokens.size() / detail::min_parallel_segment_tokens);
+
+    return parse_parallel(source, std::move(tokens), segment_count);
+}
+
+} // namespace parser
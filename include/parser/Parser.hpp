@@ -1,7 +1,13 @@
 #pragma once
 
+#include <ast/Arena.hpp>
 #include <ast/Ast.hpp>
+#include <common/Error.hpp>
+#include <common/Interner.hpp>
+#include <cstdint>
 #include <lexer/Lexer.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/TokenCursor.hpp>
 #include <parser/BlockExpressionParser.hpp>
 #include <parser/ExpressionPrattParser.hpp>
 #include <parser/ForElementParser.hpp>
@@ -11,8 +17,10 @@
 #include <parser/SimpleExpressionParser.hpp>
 #include <parser/SimpleLambdaOrIdentifierParser.hpp>
 #include <parser/StatementParser.hpp>
+#include <parser/ToplevelParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
+#include <utility>
 
 namespace parser {
 
@@ -26,12 +34,32 @@ class Parser final : public TypeParser<Parser>,
                      public ForElementParser<Parser>,
                      public ExpressionPrattParser<Parser>,
                      public LetStmtParser<Parser>,
-                     public IdentifierParser<Parser>
+                     public IdentifierParser<Parser>,
+                     public ToplevelParser<Parser>
 {
 public:
+    // the whole content is lexed up front, parsing then only walks over the tokens
     constexpr explicit Parser(std::string_view content) noexcept
         : content_(content),
-          lexer_(content_) {}
+          lexer_(lexing::Lexer{content_}.tokenize_all()) {}
+
+    // all ast nodes are allocated in the given arena instead of on the heap
+    // the arena has to outlive every tree returned by the parser
+    constexpr Parser(std::string_view content, ast::Arena& arena) noexcept
+        : content_(content),
+          lexer_(lexing::Lexer{content_}.tokenize_all()),
+          arena_(&arena) {}
+
+    // parses already lexed tokens of content, e.g. a segment of a larger source
+    // the offsets of the tokens are relative to the start of content
+    constexpr Parser(std::string_view content, lexing::TokenBuffer tokens) noexcept
+        : content_(content),
+          lexer_(std::move(tokens)) {}
+
+    constexpr Parser(std::string_view content, lexing::TokenBuffer tokens, ast::Arena& arena) noexcept
+        : content_(content),
+          lexer_(std::move(tokens)),
+          arena_(&arena) {}
 
     constexpr Parser() noexcept = delete;
     constexpr Parser(Parser&&) noexcept = default;
@@ -40,6 +68,24 @@ public:
     constexpr auto operator=(const Parser&) noexcept -> Parser& = delete;
     constexpr virtual ~Parser() noexcept = default;
 
+    // expressions nested deeper than this are rejected with a NestingTooDeep error
+    // every pending operator and every nested (...), {...} or argument list counts as one level,
+    // namespaces nested deeper than this are rejected as well
+    constexpr static std::uint32_t default_max_nesting_depth = 256;
+
+    constexpr auto set_max_nesting_depth(std::uint32_t depth) noexcept -> Parser&
+    {
+        max_nesting_depth_ = depth;
+        return *this;
+    }
+
+    // identifiers are interned into the given interner instead of the global one
+    // the interner has to outlive every tree returned by the parser
+    constexpr auto set_interner(common::Interner& interner) noexcept -> Parser&
+    {
+        interner_ = &interner;
+        return *this;
+    }
 
 private:
     friend class TypeParser<Parser>;
@@ -53,9 +99,18 @@ private:
     friend class LParExpressionParser<Parser>;
     friend class SimpleLambdaOrIdentifierParser<Parser>;
     friend class LetStmtParser<Parser>;
+    friend class ToplevelParser<Parser>;
 
     std::string_view content_;
-    lexing::Lexer lexer_;
+    lexing::TokenCursor lexer_;
+    ast::Arena* arena_ = nullptr;
+    // nullptr for the global interner
+    common::Interner* interner_ = nullptr;
+    std::uint32_t nesting_depth_ = 0;
+    // the nesting depth of the condition which is being parsed, 0 if there is none
+    std::uint32_t condition_depth_ = 0;
+    std::uint32_t namespace_depth_ = 0;
+    std::uint32_t max_nesting_depth_ = default_max_nesting_depth;
 };
 
 } // namespace parser
@@ -5,7 +5,8 @@
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
 #include <expected>
-#include <lexer/Lexer.hpp>
+#include <lexer/TokenCursor.hpp>
+#include <lexer/TokenSet.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -30,132 +31,111 @@ class SimpleExpressionParser
 {
 public:
     // parses tuples, literals, lambda expressions and (expressions)
+    // the next token is peeked once and decides which sub parser is used
     constexpr auto simple_expression() noexcept
         -> std::expected<ast::Expression, common::error::Error>
     {
-        using common::error::UnexpectedToken;
         using lexing::TokenTypes;
 
-        if(auto result = integer()) {
-            return result.value();
+        auto token_res = simple_expr_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(token_res.error());
         }
+        auto token = token_res.value();
 
-        if(auto result = duoble()) {
-            return result.value();
-        }
+        switch(token.getType()) {
+        case TokenTypes::INTEGER:
+            simple_expr_lexer().pop();
+            return integer(token);
 
-        if(auto result = boolean()) {
-            return result.value();
-        }
+        case TokenTypes::DOUBLE:
+            simple_expr_lexer().pop();
+            return duoble(token);
 
-        if(auto result = self_value()) {
-            return result.value();
-        }
+        case TokenTypes::TRUE:
+            simple_expr_lexer().pop();
+            return ast::Boolean{token.getArea(), true};
 
-        if(auto result = string()) {
-            return result.value();
-        }
+        case TokenTypes::FALSE:
+            simple_expr_lexer().pop();
+            return ast::Boolean{token.getArea(), false};
 
-        if(auto result = static_cast<T*>(this)->identifier_or_simple_lambda()) {
-            return std::move(result.value());
-        }
+        case TokenTypes::SELF_VALUE:
+            simple_expr_lexer().pop();
+            return ast::SelfExpr{token.getArea()};
 
-        if(auto result = static_cast<T*>(this)->if_expression()) {
-            return std::move(result.value());
-        }
+        case TokenTypes::STANDARD_STRING:
+            simple_expr_lexer().pop();
+            return string(token);
 
-        if(auto result = static_cast<T*>(this)->block_expression()) {
-            return std::move(result.value());
-        }
+        case TokenTypes::IDENTIFIER:
+            return static_cast<T*>(this)->identifier_or_simple_lambda();
 
-        if(auto result = static_cast<T*>(this)->l_par_expression()) {
-            return std::move(result.value());
-        }
+        case TokenTypes::IF:
+            return static_cast<T*>(this)->if_expression();
 
-        auto token_res = simple_expr_lexer().peek();
-        if(not token_res.has_value()) {
-            return std::unexpected(token_res.error());
+        case TokenTypes::L_BRACKET: {
+            auto block_res = static_cast<T*>(this)->block_expression();
+            if(not block_res.has_value()) {
+                return std::unexpected(std::move(block_res.error()));
+            }
+            return ast::forward<ast::BlockExpr>(simple_expr_arena(), std::move(block_res.value()));
         }
-        auto token = std::move(token_res.value());
-
 
-        UnexpectedToken error{token.getType(),
-                              token.getArea(),
-                              TokenTypes::IDENTIFIER,
-                              TokenTypes::DOUBLE,
-                              TokenTypes::TRUE,
-                              TokenTypes::FALSE,
-                              TokenTypes::SELF_VALUE,
-                              TokenTypes::IF,
-                              TokenTypes::L_BRACKET,
-                              TokenTypes::L_PARANTHESIS};
+        case TokenTypes::L_PARANTHESIS:
+            return static_cast<T*>(this)->l_par_expression();
 
-        return std::unexpected(std::move(error));
+        default:
+            return std::unexpected(common::error::UnexpectedToken{token.getType(),
+                                                                  token.getArea(),
+                                                                  simple_expression_start});
+        }
     }
 
 private:
-    constexpr auto integer() noexcept -> std::optional<ast::Integer>
+    constexpr auto integer(lexing::Token token) noexcept -> ast::Integer
     {
-        if(not simple_expr_lexer().next_is(lexing::TokenTypes::INTEGER)) {
-            return std::nullopt;
-        }
-
-        auto token = simple_expr_lexer().peek_and_pop().value();
-        auto value = parse_int_unsafe(token.getValue());
+        auto value = parse_int_unsafe(token.getValue(simple_expr_content()));
         return ast::Integer{token.getArea(), value};
     }
 
-    constexpr auto duoble() noexcept -> std::optional<ast::Double>
+    constexpr auto duoble(lexing::Token token) noexcept -> ast::Double
     {
-        if(not simple_expr_lexer().next_is(lexing::TokenTypes::DOUBLE)) {
-            return std::nullopt;
-        }
-
-        auto token = simple_expr_lexer().peek_and_pop().value();
-        auto value = parse_double_unsafe(token.getValue());
+        auto value = parse_double_unsafe(token.getValue(simple_expr_content()));
         return ast::Double{token.getArea(), value};
     }
 
-    constexpr auto boolean() noexcept -> std::optional<ast::Boolean>
+    constexpr auto string(lexing::Token token) noexcept -> ast::String
     {
-        if(simple_expr_lexer().next_is(lexing::TokenTypes::TRUE)) {
-            auto area = simple_expr_lexer().peek_and_pop().value().getArea();
-            return ast::Boolean(area, true);
-        }
-
-        if(simple_expr_lexer().next_is(lexing::TokenTypes::FALSE)) {
-            auto area = simple_expr_lexer().peek_and_pop().value().getArea();
-            return ast::Boolean(area, false);
-        }
-
-        return std::nullopt;
+        return ast::String{token.getArea(), token.getValue(simple_expr_content())};
     }
 
-    constexpr auto self_value() noexcept -> std::optional<ast::SelfExpr>
-    {
-        if(simple_expr_lexer().next_is(lexing::TokenTypes::SELF_VALUE)) {
-            auto area = simple_expr_lexer().peek_and_pop().value().getArea();
-            return ast::SelfExpr{area};
-        }
+    // all tokens a simple expression can start with
+    constexpr static lexing::TokenSet simple_expression_start{lexing::TokenTypes::IDENTIFIER,
+                                                              lexing::TokenTypes::INTEGER,
+                                                              lexing::TokenTypes::DOUBLE,
+                                                              lexing::TokenTypes::STANDARD_STRING,
+                                                              lexing::TokenTypes::TRUE,
+                                                              lexing::TokenTypes::FALSE,
+                                                              lexing::TokenTypes::SELF_VALUE,
+                                                              lexing::TokenTypes::IF,
+                                                              lexing::TokenTypes::L_BRACKET,
+                                                              lexing::TokenTypes::L_PARANTHESIS};
 
-        return std::nullopt;
+private:
+    constexpr auto simple_expr_lexer() noexcept -> lexing::TokenCursor&
+    {
+        return static_cast<T*>(this)->lexer_;
     }
 
-    constexpr auto string() noexcept -> std::optional<ast::String>
+    constexpr auto simple_expr_arena() noexcept -> ast::Arena*
     {
-        if(simple_expr_lexer().next_is(lexing::TokenTypes::STANDARD_STRING)) {
-            auto token = simple_expr_lexer().peek_and_pop().value();
-            return ast::String{token.getArea(), token.getValue()};
-        }
-
-        return std::nullopt;
+        return static_cast<T*>(this)->arena_;
     }
 
-
-private:
-    constexpr auto simple_expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto simple_expr_content() const noexcept -> std::string_view
     {
-        return static_cast<T*>(this)->lexer_;
+        return static_cast<const T*>(this)->content_;
     }
 };
 
@@ -2,7 +2,9 @@
 
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -17,14 +19,15 @@ template<class T>
 class SimpleLambdaOrIdentifierParser
 {
 public:
-    constexpr auto identifier_or_simple_lambda() noexcept -> std::optional<ast::Expression>
+    constexpr auto identifier_or_simple_lambda() noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-
-        if(auto result = static_cast<T*>(this)->identifier()) {
-            return simple_lambda(std::move(result.value()));
+        auto id_res = static_cast<T*>(this)->identifier();
+        if(not id_res.has_value()) {
+            return std::unexpected(std::move(id_res.error()));
         }
 
-        return std::nullopt;
+        return simple_lambda(std::move(id_res.value()));
     }
 
 private:
@@ -34,44 +37,48 @@ private:
     // if this is not the case it simply returns the already parsed parameter again
     // if the identifier is followed by a : it is assumed that this shoud be a lambda expression and after
     // the : comes the type annotation but a : b => c is not clear since it could be (a : b) => c or a: (b => c)
-    // therefore this is forbitten and an error should be returned that lambda parameters with type annotations
+    // therefore this is forbitten and an error is returned that lambda parameters with type annotations
     // need to be enclosed by ()
-    constexpr auto simple_lambda(ast::Identifier&& parameter) noexcept -> std::optional<ast::Expression>
+    constexpr auto simple_lambda(ast::Identifier&& parameter) noexcept
+        -> std::expected<ast::Expression, common::error::Error>
     {
-
         if(simple_lambda_or_id_expr_lexer().next_is(lexing::TokenTypes::COLON)) {
-            // TODO: return "lambda parameters with type annotations need to be enclosed by ()"
-            return std::nullopt;
+            return std::unexpected(common::error::InvalidLambdaParameter{parameter.getArea()});
         }
 
         if(not simple_lambda_or_id_expr_lexer().pop_next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
             return std::move(parameter);
         }
 
-        auto expr_opt = static_cast<T*>(this)->expression();
-        if(not expr_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto expr_res = static_cast<T*>(this)->expression();
+        if(not expr_res.has_value()) {
+            return std::unexpected(std::move(expr_res.error()));
         }
-        auto expr = std::move(expr_opt.value());
+        auto expr = std::move(expr_res.value());
 
         auto start = parameter.getArea();
         auto end = ast::getTextArea(expr);
         auto area = lexing::TextArea::combine(start, end);
 
-        std::vector<ast::LambdaParameter> parameters;
+        ast::LambdaParameterList parameters;
         parameters.emplace_back(std::move(parameter));
 
         return ast::Expression{
-            ast::forward<ast::LambdaExpr>(area,
+            ast::forward<ast::LambdaExpr>(simple_lambda_or_id_expr_arena(),
+                                          area,
                                           std::move(parameters),
                                           std::move(expr))};
     }
 
 private:
-    constexpr auto simple_lambda_or_id_expr_lexer() noexcept -> lexing::Lexer&
+    constexpr auto simple_lambda_or_id_expr_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto simple_lambda_or_id_expr_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 } // namespace parser
@@ -2,7 +2,9 @@
 
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
-#include <lexer/Lexer.hpp>
+#include <common/Error.hpp>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
 #include <optional>
 #include <parser/TypeParser.hpp>
 #include <parser/Utils.hpp>
@@ -19,84 +21,96 @@ template<class T>
 class StatmentParser
 {
 public:
-    constexpr auto statement() noexcept -> std::optional<ast::Statement>
+    constexpr auto statement() noexcept
+        -> std::expected<ast::Statement, common::error::Error>
     {
-        if(stmt_lexer().next_is(lexing::TokenTypes::LET)) {
-            // TODO: change once we return std::expected
-            if(auto result = static_cast<T*>(this)->let()) {
-                return std::move(result.value());
-            }
-            return std::nullopt;
+        auto token_res = stmt_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(std::move(token_res.error()));
         }
 
-        if(stmt_lexer().next_is(lexing::TokenTypes::WHILE)) {
+        switch(token_res.value().getType()) {
+        case lexing::TokenTypes::LET:
+            return static_cast<T*>(this)->let();
+
+        case lexing::TokenTypes::WHILE:
             return wile();
-        }
 
-        if(stmt_lexer().next_is(lexing::TokenTypes::IF)) {
+        case lexing::TokenTypes::IF:
             return ifStmt();
-        }
 
-        if(stmt_lexer().next_is(lexing::TokenTypes::FOR)) {
+        case lexing::TokenTypes::FOR:
             return forStmt();
+
+        default:
+            break;
         }
 
-        // TODO: just return static_cast<T*>(this)->expression();
-        if(auto res = static_cast<T*>(this)->expression()) {
-            return std::move(res.value());
+        auto expr_res = static_cast<T*>(this)->expression();
+        if(not expr_res.has_value()) {
+            return std::unexpected(std::move(expr_res.error()));
         }
 
-        return std::nullopt;
+        return std::move(expr_res.value());
     }
 
 private:
-    constexpr auto stmt_list() noexcept -> std::optional<std::vector<ast::Statement>>
+    // parses statements separated by newlines or ; until the closing } which is not popped
+    constexpr auto stmt_list() noexcept
+        -> std::expected<std::vector<ast::Statement>, common::error::Error>
     {
         std::vector<ast::Statement> stmts;
 
         while(true) {
-            auto stmt_opt = statement();
-            if(not stmt_opt.has_value()) {
-                // TODO: propagate error
-                return std::nullopt;
+            while(stmt_lexer().next_is(lexing::TokenTypes::NEWLINE)
+                  or stmt_lexer().next_is(lexing::TokenTypes::SEMICOLON)) {
+                stmt_lexer().pop();
             }
-            stmts.emplace_back(std::move(stmt_opt.value()));
 
-            auto next_token_opt = stmt_lexer().peek_and_pop();
-            if(not next_token_opt.has_value()) {
-                // TODO: return expected a token from the lexer, got none this seems to be a lexer bug
-                return std::nullopt;
+            if(stmt_lexer().next_is(lexing::TokenTypes::R_BRACKET)) {
+                return stmts;
             }
-            auto next_token = std::move(next_token_opt.value());
 
-            if(not next_token.isSeparator()) {
-                // TODO: return error next token expected to be a ; or \n
-                return std::nullopt;
+            auto stmt_res = statement();
+            if(not stmt_res.has_value()) {
+                return std::unexpected(std::move(stmt_res.error()));
             }
-        }
+            stmts.emplace_back(std::move(stmt_res.value()));
 
-        return stmts;
+            auto next_token_res = stmt_lexer().peek();
+            if(not next_token_res.has_value()) {
+                return std::unexpected(std::move(next_token_res.error()));
+            }
+            auto next_token = std::move(next_token_res.value());
+
+            if(not next_token.isSeparator() and next_token.getType() != lexing::TokenTypes::R_BRACKET) {
+                return std::unexpected(
+                    common::error::UnexpectedToken{next_token.getType(),
+                                                   next_token.getArea(),
+                                                   lexing::TokenTypes::NEWLINE,
+                                                   lexing::TokenTypes::SEMICOLON,
+                                                   lexing::TokenTypes::R_BRACKET});
+            }
+        }
     }
 
-    constexpr auto block() noexcept -> std::optional<std::pair<std::vector<ast::Statement>, lexing::TextArea>>
+    constexpr auto block() noexcept
+        -> std::expected<std::pair<std::vector<ast::Statement>, lexing::TextArea>, common::error::Error>
     {
         if(not stmt_lexer().next_is(lexing::TokenTypes::L_BRACKET)) {
-            // TODO: return expected {
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::L_BRACKET));
         }
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
-        auto body_opt = stmt_list();
-        if(not body_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto body_res = stmt_list();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto body = std::move(body_opt.value());
+        auto body = std::move(body_res.value());
 
 
-        if(not stmt_lexer().next_is(lexing::TokenTypes::L_BRACKET)) {
-            // TODO: return expected }
-            return std::nullopt;
+        if(not stmt_lexer().next_is(lexing::TokenTypes::R_BRACKET)) {
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::R_BRACKET));
         }
 
         auto end = stmt_lexer().peek_and_pop().value().getArea();
@@ -105,50 +119,51 @@ private:
         return std::pair{std::move(body), std::move(area)};
     }
 
-    constexpr auto wile() noexcept -> std::optional<ast::Statement>
+    constexpr auto wile() noexcept
+        -> std::expected<ast::Statement, common::error::Error>
     {
         // sanity check
         if(not stmt_lexer().next_is(lexing::TokenTypes::WHILE)) {
-            // TODO: return expexted "while" token
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::WHILE));
         }
 
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
-        auto condition_opt = static_cast<T*>(this)->expression();
-        if(not condition_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto condition_res = static_cast<T*>(this)->condition();
+        if(not condition_res.has_value()) {
+            return std::unexpected(std::move(condition_res.error()));
         }
-        auto condition = std::move(condition_opt.value());
+        auto condition = std::move(condition_res.value());
 
-        auto body_opt = block();
-        if(not body_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto body_res = block();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto [body, end] = std::move(body_opt.value());
+        auto [body, end] = std::move(body_res.value());
         auto area = lexing::TextArea::combine(start, end);
 
         return ast::Statement{
-            ast::forward<ast::WhileStmt>(area,
+            ast::forward<ast::WhileStmt>(stmt_arena(),
+                                         area,
                                          std::move(condition),
                                          std::move(body))};
     }
 
-    constexpr auto forStmt() noexcept -> std::optional<ast::Statement>
+    constexpr auto forStmt() noexcept
+        -> std::expected<ast::Statement, common::error::Error>
     {
+        using lexing::TokenTypes;
+
         // sanity check
-        if(not stmt_lexer().next_is(lexing::TokenTypes::FOR)) {
-            return std::nullopt;
+        if(not stmt_lexer().next_is(TokenTypes::FOR)) {
+            return std::unexpected(unexpected_next_token(stmt_lexer(), TokenTypes::FOR));
         }
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
         // clang-format off
-                if(not stmt_lexer().next_is(lexing::TokenTypes::L_BRACKET) and
-                   not stmt_lexer().next_is(lexing::TokenTypes::L_PARANTHESIS)) {
-                        // TODO: return error "expected ( or {"
-                        return std::nullopt;
+                if(not stmt_lexer().next_is(TokenTypes::L_BRACKET) and
+                   not stmt_lexer().next_is(TokenTypes::L_PARANTHESIS)) {
+                        return std::unexpected(unexpected_next_token(stmt_lexer(), TokenTypes::L_PARANTHESIS, TokenTypes::L_BRACKET));
                 }
         // clang-format on
 
@@ -157,81 +172,77 @@ private:
         std::vector<ast::ForElement> elems;
 
         // clang-format off
-                while(not stmt_lexer().next_is(lexing::TokenTypes::L_BRACKET) and
-                          not stmt_lexer().next_is(lexing::TokenTypes::L_PARANTHESIS)) {
+                while(not stmt_lexer().next_is(TokenTypes::L_BRACKET) and
+                          not stmt_lexer().next_is(TokenTypes::L_PARANTHESIS)) {
 
-                        auto elem_opt = stmt_for_element();
-                        if(not elem_opt.has_value()) {
-                                // TODO: propagate error
-                                return std::nullopt;
+                        auto elem_res = stmt_for_element();
+                        if(not elem_res.has_value()) {
+                                return std::unexpected(std::move(elem_res.error()));
                         }
 
-                        elems.emplace_back(std::move(elem_opt.value()));
+                        elems.emplace_back(std::move(elem_res.value()));
                 }
         // clang-format on
 
         if(not stmt_lexer().pop_next_is(enclosing_type)) {
-            // TODO: return "expected $enclosing_type" error
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), enclosing_type));
         }
 
-        auto block_opt = block();
-        if(not block_opt.has_value()) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto block_res = block();
+        if(not block_res.has_value()) {
+            return std::unexpected(std::move(block_res.error()));
         }
-        auto [block, end] = std::move(block_opt.value());
+        auto [block, end] = std::move(block_res.value());
 
         auto area = lexing::TextArea::combine(start, end);
 
         return ast::Statement{
-            ast::forward<ast::ForStmt>(std::move(area),
+            ast::forward<ast::ForStmt>(stmt_arena(),
+                                       std::move(area),
                                        std::move(elems),
                                        std::move(block))};
     }
 
-    constexpr auto elseStmt() noexcept -> std::optional<ast::ElseStmt>
+    constexpr auto elseStmt() noexcept
+        -> std::expected<ast::ElseStmt, common::error::Error>
     {
         if(not stmt_lexer().next_is(lexing::TokenTypes::ELSE)) {
-            // TODO: return error "expected else kexword"
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::ELSE));
         }
 
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
-        auto body_opt = block();
-        if(not body_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto body_res = block();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto [body, end] = std::move(body_opt.value());
+        auto [body, end] = std::move(body_res.value());
 
         auto area = lexing::TextArea::combine(start, end);
 
         return ast::ElseStmt{area, std::move(body)};
     }
 
-    constexpr auto elifStmt() noexcept -> std::optional<ast::ElifStmt>
+    constexpr auto elifStmt() noexcept
+        -> std::expected<ast::ElifStmt, common::error::Error>
     {
         if(not stmt_lexer().next_is(lexing::TokenTypes::ELIF)) {
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::ELIF));
         }
 
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
-        auto elif_condition_opt = static_cast<T*>(this)->expression();
-        if(not elif_condition_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto elif_condition_res = static_cast<T*>(this)->condition();
+        if(not elif_condition_res.has_value()) {
+            return std::unexpected(std::move(elif_condition_res.error()));
         }
-        auto elif_condition = std::move(elif_condition_opt.value());
+        auto elif_condition = std::move(elif_condition_res.value());
 
-        auto body_opt = block();
-        if(not body_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto body_res = block();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto [body, end] = std::move(body_opt.value());
+        auto [body, end] = std::move(body_res.value());
 
         auto area = lexing::TextArea::combine(start, end);
 
@@ -240,54 +251,52 @@ private:
                              std::move(body)};
     }
 
-    constexpr auto ifStmt() noexcept -> std::optional<ast::Statement>
+    constexpr auto ifStmt() noexcept
+        -> std::expected<ast::Statement, common::error::Error>
     {
         if(not stmt_lexer().next_is(lexing::TokenTypes::IF)) {
-            return std::nullopt;
+            return std::unexpected(unexpected_next_token(stmt_lexer(), lexing::TokenTypes::IF));
         }
 
         auto start = stmt_lexer().peek_and_pop().value().getArea();
 
-        auto condition_opt = static_cast<T*>(this)->expression();
-        if(not condition_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto condition_res = static_cast<T*>(this)->condition();
+        if(not condition_res.has_value()) {
+            return std::unexpected(std::move(condition_res.error()));
         }
-        auto condition = std::move(condition_opt.value());
+        auto condition = std::move(condition_res.value());
 
-        auto body_opt = block();
-        if(not body_opt) {
-            // TODO: propagate error
-            return std::nullopt;
+        auto body_res = block();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
         }
-        auto [body, end] = std::move(body_opt.value());
+        auto [body, end] = std::move(body_res.value());
 
         auto area = lexing::TextArea::combine(start, end);
 
         std::vector<ast::ElifStmt> elifs;
         while(stmt_lexer().next_is(lexing::TokenTypes::ELIF)) {
-            auto elif_opt = elifStmt();
-            if(not elif_opt) {
-                // TODO: propagate error
-                return std::nullopt;
+            auto elif_res = elifStmt();
+            if(not elif_res.has_value()) {
+                return std::unexpected(std::move(elif_res.error()));
             }
-            elifs.emplace_back(std::move(elif_opt.value()));
+            elifs.emplace_back(std::move(elif_res.value()));
             area = lexing::TextArea::combine(start, elifs.back().getArea());
         }
 
         std::optional<ast::ElseStmt> else_;
         if(stmt_lexer().next_is(lexing::TokenTypes::ELSE)) {
-            auto else_opt = elseStmt();
-            if(not else_opt.has_value()) {
-                // TODO: propagate error
-                return std::nullopt;
+            auto else_res = elseStmt();
+            if(not else_res.has_value()) {
+                return std::unexpected(std::move(else_res.error()));
             }
-            area = lexing::TextArea::combine(start, else_opt.value().getArea());
-            else_ = std::move(else_opt.value());
+            area = lexing::TextArea::combine(start, else_res.value().getArea());
+            else_ = std::move(else_res.value());
         }
 
         return ast::Statement{
-            ast::forward<ast::IfStmt>(area,
+            ast::forward<ast::IfStmt>(stmt_arena(),
+                                      area,
                                       std::move(condition),
                                       std::move(body),
                                       std::move(elifs),
@@ -298,25 +307,32 @@ private:
 
 private:
     constexpr auto stmt_identifier() noexcept
-        -> std::optional<ast::Identifier>
+        -> std::expected<ast::Identifier, common::error::Error>
     {
         return static_cast<T*>(this)->identifier();
     }
 
-    constexpr auto stmt_for_element() noexcept -> std::optional<ast::ForElement>
+    constexpr auto stmt_for_element() noexcept
+        -> std::expected<ast::ForElement, common::error::Error>
     {
         return static_cast<T*>(this)->for_element();
     }
 
-    constexpr auto stmt_type() noexcept -> std::optional<ast::Type>
+    constexpr auto stmt_type() noexcept
+        -> std::expected<ast::Type, common::error::Error>
     {
         return static_cast<T*>(this)->type();
     }
 
-    constexpr auto stmt_lexer() noexcept -> lexing::Lexer&
+    constexpr auto stmt_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto stmt_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 
 } // namespace parser
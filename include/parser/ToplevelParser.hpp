@@ -0,0 +1,357 @@
+#pragma once
+
+#include <ast/Ast.hpp>
+#include <ast/Forward.hpp>
+#include <common/Error.hpp>
+#include <cstdint>
+#include <expected>
+#include <lexer/TokenCursor.hpp>
+#include <lexer/TokenSet.hpp>
+#include <lexer/Tokens.hpp>
+#include <utility>
+#include <variant>
+#include <vector>
+
+namespace parser {
+
+namespace detail {
+
+// the tokens with which the top level elements the parser understands start
+constexpr lexing::TokenSet toplevel_start{lexing::TokenTypes::LET,
+                                          lexing::TokenTypes::FUN,
+                                          lexing::TokenTypes::NAMESPACE};
+
+constexpr auto starts_toplevel_element(lexing::TokenTypes type) noexcept -> bool
+{
+    return toplevel_start.contains(type);
+}
+
+// finds the tokens at which top level elements start without parsing them.
+// an element starts with a top level keyword at the beginning of a line which is not
+// enclosed by any bracket, the brackets are matched by feeding every token type in order.
+// unbalanced brackets make the depth negative, no element starts until they are closed again
+// such that the parser reports the error
+class ToplevelBoundaries
+{
+public:
+    // returns true if a top level element starts with the given token
+    constexpr auto starts_element(lexing::TokenTypes type) noexcept -> bool
+    {
+        const auto starts = depth_ == 0 and line_start_ and starts_toplevel_element(type);
+
+        switch(type) {
+        case lexing::TokenTypes::L_PARANTHESIS:
+        case lexing::TokenTypes::L_BRACKET:
+            depth_++;
+            break;
+        case lexing::TokenTypes::R_PARANTHESIS:
+        case lexing::TokenTypes::R_BRACKET:
+            depth_--;
+            break;
+        default:
+            break;
+        }
+
+        line_start_ = type == lexing::TokenTypes::NEWLINE
+            or type == lexing::TokenTypes::SEMICOLON;
+
+        return starts;
+    }
+
+private:
+    std::int64_t depth_ = 0;
+    bool line_start_ = true;
+};
+
+} // namespace detail
+
+// crtp class for the elements at the top level of a source file,
+// every element starts on its own line or after a ;
+// 1. let assignments
+// 2. functions: fun name(a: A, b: B): Result = expression
+// 3. namespaces: namespace name { elements }
+// imports, type and typeclass definitions are not part of the top level grammar
+template<class T>
+class ToplevelParser
+{
+public:
+    constexpr static lexing::TokenSet toplevel_start = detail::toplevel_start;
+
+    constexpr auto toplevel_element() noexcept
+        -> std::expected<ast::ToplevelElement, common::error::Error>
+    {
+        auto token_res = toplevel_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(std::move(token_res.error()));
+        }
+        auto token = token_res.value();
+
+        switch(token.getType()) {
+        case lexing::TokenTypes::LET: {
+            auto let_res = static_cast<T*>(this)->let();
+            if(not let_res.has_value()) {
+                return std::unexpected(std::move(let_res.error()));
+            }
+
+            return ast::ToplevelElement{
+                std::get<ast::Forward<ast::LetAssignment>>(std::move(let_res.value()))};
+        }
+
+        case lexing::TokenTypes::FUN:
+            return function();
+
+        case lexing::TokenTypes::NAMESPACE:
+            return namespace_();
+
+        default:
+            return std::unexpected(
+                common::error::UnexpectedToken{token.getType(),
+                                               token.getArea(),
+                                               toplevel_start});
+        }
+    }
+
+    // parses all top level elements until the end of the file
+    constexpr auto toplevel() noexcept
+        -> std::expected<std::vector<ast::ToplevelElement>, common::error::Error>
+    {
+        return toplevel_elements(lexing::TokenTypes::END_OF_FILE);
+    }
+
+private:
+    // parses elements separated by newlines or ; until the end token which is not popped
+    constexpr auto toplevel_elements(lexing::TokenTypes end_token) noexcept
+        -> std::expected<std::vector<ast::ToplevelElement>, common::error::Error>
+    {
+        std::vector<ast::ToplevelElement> elements;
+
+        while(true) {
+            skip_separators();
+            if(toplevel_lexer().next_is(end_token)) {
+                return elements;
+            }
+
+            auto element_res = toplevel_element();
+            if(not element_res.has_value()) {
+                return std::unexpected(std::move(element_res.error()));
+            }
+            elements.emplace_back(std::move(element_res.value()));
+
+            auto next_res = toplevel_lexer().peek();
+            if(not next_res.has_value()) {
+                return std::unexpected(std::move(next_res.error()));
+            }
+            auto next = next_res.value();
+
+            if(not next.isSeparator() and next.getType() != end_token) {
+                return std::unexpected(
+                    common::error::UnexpectedToken{next.getType(),
+                                                   next.getArea(),
+                                                   lexing::TokenTypes::NEWLINE,
+                                                   lexing::TokenTypes::SEMICOLON,
+                                                   end_token});
+            }
+        }
+    }
+
+    constexpr auto function() noexcept
+        -> std::expected<ast::ToplevelElement, common::error::Error>
+    {
+        using lexing::TokenTypes;
+
+        auto fun_res = expect(TokenTypes::FUN);
+        if(not fun_res.has_value()) {
+            return std::unexpected(std::move(fun_res.error()));
+        }
+        auto start = fun_res.value().getArea();
+
+        auto name_res = static_cast<T*>(this)->identifier();
+        if(not name_res.has_value()) {
+            return std::unexpected(std::move(name_res.error()));
+        }
+        auto name = std::move(name_res.value());
+
+        auto params_res = function_parameters();
+        if(not params_res.has_value()) {
+            return std::unexpected(std::move(params_res.error()));
+        }
+        auto params = std::move(params_res.value());
+
+        auto colon_res = expect(TokenTypes::COLON);
+        if(not colon_res.has_value()) {
+            return std::unexpected(std::move(colon_res.error()));
+        }
+
+        auto return_type_res = static_cast<T*>(this)->type();
+        if(not return_type_res.has_value()) {
+            return std::unexpected(std::move(return_type_res.error()));
+        }
+        auto return_type = std::move(return_type_res.value());
+
+        auto assign_res = expect(TokenTypes::ASSIGN);
+        if(not assign_res.has_value()) {
+            return std::unexpected(std::move(assign_res.error()));
+        }
+
+        // the body is a single expression, a body with statements is a block expression
+        auto body_res = static_cast<T*>(this)->expression();
+        if(not body_res.has_value()) {
+            return std::unexpected(std::move(body_res.error()));
+        }
+        auto area = lexing::TextArea::combine(start, ast::getTextArea(body_res.value()));
+
+        std::vector<ast::FunctionStatement> body;
+        body.emplace_back(std::move(body_res.value()));
+
+        return ast::ToplevelElement{
+            ast::forward<ast::FunctionDefinition>(toplevel_arena(),
+                                                  area,
+                                                  std::move(name),
+                                                  std::move(params),
+                                                  std::move(return_type),
+                                                  std::move(body))};
+    }
+
+    // (a: A, b: B), every parameter needs a type
+    constexpr auto function_parameters() noexcept
+        -> std::expected<std::vector<ast::FunctionParameter>, common::error::Error>
+    {
+        using lexing::TokenTypes;
+
+        auto lpar_res = expect(TokenTypes::L_PARANTHESIS);
+        if(not lpar_res.has_value()) {
+            return std::unexpected(std::move(lpar_res.error()));
+        }
+
+        std::vector<ast::FunctionParameter> params;
+        if(toplevel_lexer().pop_next_is(TokenTypes::R_PARANTHESIS)) {
+            return params;
+        }
+
+        while(true) {
+            auto name_res = static_cast<T*>(this)->identifier();
+            if(not name_res.has_value()) {
+                return std::unexpected(std::move(name_res.error()));
+            }
+            auto name = std::move(name_res.value());
+
+            auto colon_res = expect(TokenTypes::COLON);
+            if(not colon_res.has_value()) {
+                return std::unexpected(std::move(colon_res.error()));
+            }
+
+            auto type_res = static_cast<T*>(this)->type();
+            if(not type_res.has_value()) {
+                return std::unexpected(std::move(type_res.error()));
+            }
+            auto type = std::move(type_res.value());
+
+            auto area = lexing::TextArea::combine(name.getArea(), ast::getTextArea(type));
+            params.emplace_back(area, std::move(name), std::move(type));
+
+            auto next_res = toplevel_lexer().peek_and_pop();
+            if(not next_res.has_value()) {
+                return std::unexpected(std::move(next_res.error()));
+            }
+            auto next = next_res.value();
+
+            if(next.getType() == TokenTypes::R_PARANTHESIS) {
+                return params;
+            }
+
+            if(next.getType() != TokenTypes::COMMA) {
+                return std::unexpected(
+                    common::error::UnexpectedToken{next.getType(),
+                                                   next.getArea(),
+                                                   TokenTypes::COMMA,
+                                                   TokenTypes::R_PARANTHESIS});
+            }
+        }
+    }
+
+    // namespaces can be nested, every level counts towards the nesting limit of the parser
+    constexpr auto namespace_() noexcept
+        -> std::expected<ast::ToplevelElement, common::error::Error>
+    {
+        using lexing::TokenTypes;
+
+        auto namespace_res = expect(TokenTypes::NAMESPACE);
+        if(not namespace_res.has_value()) {
+            return std::unexpected(std::move(namespace_res.error()));
+        }
+        auto start = namespace_res.value().getArea();
+
+        auto& depth = static_cast<T*>(this)->namespace_depth_;
+        if(depth >= static_cast<T*>(this)->max_nesting_depth_) {
+            return std::unexpected(
+                common::error::NestingTooDeep{start, static_cast<T*>(this)->max_nesting_depth_});
+        }
+
+        auto name_res = static_cast<T*>(this)->identifier();
+        if(not name_res.has_value()) {
+            return std::unexpected(std::move(name_res.error()));
+        }
+        auto name = std::move(name_res.value());
+
+        auto lbracket_res = expect(TokenTypes::L_BRACKET);
+        if(not lbracket_res.has_value()) {
+            return std::unexpected(std::move(lbracket_res.error()));
+        }
+
+        depth++;
+        auto elements_res = toplevel_elements(TokenTypes::R_BRACKET);
+        depth--;
+
+        if(not elements_res.has_value()) {
+            return std::unexpected(std::move(elements_res.error()));
+        }
+
+        auto end = toplevel_lexer().peek_and_pop().value().getArea();
+        auto area = lexing::TextArea::combine(start, end);
+
+        return ast::ToplevelElement{
+            ast::forward<ast::Namespace>(toplevel_arena(),
+                                         area,
+                                         std::move(name),
+                                         std::move(elements_res.value()))};
+    }
+
+    // pops the next token if it has the given type
+    constexpr auto expect(lexing::TokenTypes type) noexcept
+        -> std::expected<lexing::Token, common::error::Error>
+    {
+        auto token_res = toplevel_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(std::move(token_res.error()));
+        }
+        auto token = token_res.value();
+
+        if(token.getType() != type) {
+            return std::unexpected(
+                common::error::UnexpectedToken{token.getType(), token.getArea(), type});
+        }
+
+        toplevel_lexer().pop();
+        return token;
+    }
+
+    constexpr auto skip_separators() noexcept -> void
+    {
+        while(toplevel_lexer().next_is(lexing::TokenTypes::NEWLINE)
+              or toplevel_lexer().next_is(lexing::TokenTypes::SEMICOLON)) {
+            toplevel_lexer().pop();
+        }
+    }
+
+    constexpr auto toplevel_lexer() noexcept -> lexing::TokenCursor&
+    {
+        return static_cast<T*>(this)->lexer_;
+    }
+
+    constexpr auto toplevel_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
+};
+
+} // namespace parser
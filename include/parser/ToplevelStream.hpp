@@ -0,0 +1,219 @@
+#pragma once
+
+#include <ast/Arena.hpp>
+#include <ast/Ast.hpp>
+#include <common/Error.hpp>
+#include <common/Interner.hpp>
+#include <cstddef>
+#include <expected>
+#include <iterator>
+#include <lexer/Lexer.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/Tokens.hpp>
+#include <memory>
+#include <optional>
+#include <parser/Parser.hpp>
+#include <parser/ToplevelParser.hpp>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+namespace parser {
+
+// tag to create a ToplevelStream whose elements can be kept after the next one was parsed
+struct RetainElements
+{};
+
+// parses the top level elements of a source one at a time.
+// the source is lexed on demand up to the start of the next element, which is then parsed
+// on its own. the nodes and the names of the identifiers of an element are kept in an arena
+// and an interner which are both reset before the next element, so peak memory is bounded
+// by the largest element instead of the whole source.
+// the elements are the same as the ones of Parser::toplevel, after the first error the stream ends
+class ToplevelStream
+{
+public:
+    using Result = std::expected<ast::ToplevelElement, common::error::Error>;
+
+    class Iterator;
+
+    // the stream owns the arena and the interner of the elements
+    // an element is only valid until the next element is parsed
+    explicit ToplevelStream(std::string_view content) noexcept
+        : content_(content),
+          lexer_(content),
+          owned_arena_(std::make_unique<ast::Arena>()),
+          owned_interner_(std::make_unique<common::Interner>()),
+          arena_(owned_arena_.get()),
+          interner_(owned_interner_.get()) {}
+
+    // like above, but with an arena and an interner of the caller which are reset before every element
+    constexpr ToplevelStream(std::string_view content, ast::Arena& arena, common::Interner& interner) noexcept
+        : content_(content),
+          lexer_(content),
+          arena_(&arena),
+          interner_(&interner) {}
+
+    // the nodes of the elements are allocated on the heap and their names are interned into
+    // the global interner, every element can be kept or dropped by the caller.
+    // memory is not bounded in this mode, it grows with the number of distinct names of the source
+    constexpr ToplevelStream(std::string_view content, RetainElements /*unused*/) noexcept
+        : content_(content),
+          lexer_(content) {}
+
+    constexpr ToplevelStream(ToplevelStream&&) noexcept = default;
+    constexpr auto operator=(ToplevelStream&&) noexcept -> ToplevelStream& = default;
+    constexpr ToplevelStream(const ToplevelStream&) noexcept = delete;
+    constexpr auto operator=(const ToplevelStream&) noexcept -> ToplevelStream& = delete;
+
+    // the interner the names of the identifiers of the elements are interned into
+    auto get_interner() const noexcept -> const common::Interner&
+    {
+        return interner_ != nullptr ? *interner_ : common::Interner::global();
+    }
+
+    // returns the next element or nothing once the end of the source or an error is reached
+    auto next() noexcept -> std::optional<Result>
+    {
+        while(parsed_index_ == parsed_.size()) {
+            if(done_) {
+                return std::nullopt;
+            }
+
+            // the previous elements have been handed out already
+            parsed_.clear();
+            parsed_index_ = 0;
+            if(arena_ != nullptr) {
+                arena_->reset();
+            }
+            if(interner_ != nullptr) {
+                interner_->clear();
+            }
+
+            auto result = parse_element(next_element_tokens());
+            if(not result.has_value()) {
+                done_ = true;
+                return std::unexpected(std::move(result.error()));
+            }
+
+            parsed_ = std::move(result.value());
+        }
+
+        return std::move(parsed_[parsed_index_++]);
+    }
+
+    auto begin() noexcept -> Iterator;
+
+    constexpr auto end() const noexcept -> std::default_sentinel_t
+    {
+        return std::default_sentinel;
+    }
+
+private:
+    // lexes all tokens up to the start of the next top level element
+    // the buffer is closed by an END_OF_FILE token placed where the next element starts
+    constexpr auto next_element_tokens() noexcept -> lexing::TokenBuffer
+    {
+        lexing::TokenBuffer tokens;
+        bool has_element = false;
+
+        while(true) {
+            auto token_res = lexer_.peek();
+            if(not token_res.has_value()) {
+                tokens.setError(std::move(token_res.error()));
+                done_ = true;
+                return tokens;
+            }
+            auto token = token_res.value();
+
+            if(token.getType() == lexing::TokenTypes::END_OF_FILE) {
+                tokens.push_back(token);
+                done_ = true;
+                return tokens;
+            }
+
+            if(boundaries_.starts_element(token.getType()) and has_element) {
+                tokens.push_back(lexing::Token{lexing::TokenTypes::END_OF_FILE, token.getOffset(), 0});
+                return tokens;
+            }
+
+            has_element = has_element or not token.isSeparator();
+            tokens.push_back(token);
+            lexer_.pop();
+        }
+    }
+
+    constexpr auto parse_element(lexing::TokenBuffer tokens) noexcept
+        -> std::expected<std::vector<ast::ToplevelElement>, common::error::Error>
+    {
+        if(arena_ == nullptr) {
+            return Parser{content_, std::move(tokens)}.toplevel();
+        }
+
+        return Parser{content_, std::move(tokens), *arena_}
+            .set_interner(*interner_)
+            .toplevel();
+    }
+
+private:
+    std::string_view content_;
+    lexing::Lexer lexer_;
+    std::unique_ptr<ast::Arena> owned_arena_;
+    std::unique_ptr<common::Interner> owned_interner_;
+    // both are nullptr if the elements are retained
+    ast::Arena* arena_ = nullptr;
+    common::Interner* interner_ = nullptr;
+    detail::ToplevelBoundaries boundaries_;
+    // the elements of the last parsed part of the source which were not handed out yet
+    // usually this is a single element
+    std::vector<ast::ToplevelElement> parsed_;
+    std::size_t parsed_index_ = 0;
+    bool done_ = false;
+};
+
+// an input iterator over the elements of a ToplevelStream
+// which allows to consume them with a range based for loop
+class ToplevelStream::Iterator
+{
+public:
+    using value_type = Result;
+    using difference_type = std::ptrdiff_t;
+
+    explicit Iterator(ToplevelStream& stream) noexcept
+        : stream_(&stream),
+          current_(stream.next()) {}
+
+    constexpr auto operator*() noexcept -> Result&
+    {
+        return current_.value();
+    }
+
+    auto operator++() noexcept -> Iterator&
+    {
+        // the current element has to be dropped before the arena is reset
+        current_.reset();
+        current_ = stream_->next();
+        return *this;
+    }
+
+    auto operator++(int) noexcept -> void
+    {
+        ++*this;
+    }
+
+    constexpr auto operator==(std::default_sentinel_t /*unused*/) const noexcept -> bool
+    {
+        return not current_.has_value();
+    }
+
+private:
+    ToplevelStream* stream_;
+    std::optional<Result> current_;
+};
+
+inline auto ToplevelStream::begin() noexcept -> Iterator
+{
+    return Iterator{*this};
+}
+
+} // namespace parser
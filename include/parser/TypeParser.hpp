@@ -6,7 +6,7 @@
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
 #include <exception>
-#include <lexer/Lexer.hpp>
+#include <lexer/TokenCursor.hpp>
 #include <parser/IdentifierParser.hpp>
 #include <parser/Utils.hpp>
 #include <string_view>
@@ -21,33 +21,14 @@ public:
     constexpr auto type() noexcept
         -> std::expected<ast::Type, common::error::Error>
     {
-        using lexing::TokenTypes;
-        using common::error::UnexpectedToken;
-
-        auto start_type_res = [this] {
-            if(type_lexer().next_is(TokenTypes::L_PARANTHESIS)) {
-                return compound_type();
-            }
-            if(type_lexer().next_is(TokenTypes::SELF_TYPE)) {
-                return self_type();
-            }
-            return named_type();
-        }();
+        auto token_res = type_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(token_res.error());
+        }
 
+        auto start_type_res = start_type(token_res.value());
         if(not start_type_res) {
-            auto lex_res = type_lexer().peek_and_pop();
-            if(not lex_res.has_value()) {
-                return std::unexpected(lex_res.error());
-            }
-
-            auto token = std::move(lex_res.value());
-
-            UnexpectedToken error{token.getType(),
-                                  token.getArea(),
-                                  TokenTypes::IDENTIFIER,
-                                  TokenTypes::SELF_TYPE,
-                                  TokenTypes::L_PARANTHESIS};
-            return std::unexpected(std::move(error));
+            return std::unexpected(std::move(start_type_res.error()));
         }
 
         auto start_type = std::move(start_type_res.value());
@@ -56,10 +37,39 @@ public:
     }
 
 private:
+    // dispatches on the first token of a type
+    constexpr auto start_type(lexing::Token first) noexcept
+        -> std::expected<ast::Type, common::error::Error>
+    {
+        using common::error::UnexpectedToken;
+        using lexing::TokenTypes;
+
+        switch(first.getType()) {
+        case TokenTypes::L_PARANTHESIS:
+            return compound_type();
+        case TokenTypes::SELF_TYPE:
+            return self_type();
+        case TokenTypes::IDENTIFIER:
+            return named_type();
+        default:
+            return std::unexpected(UnexpectedToken{first.getType(),
+                                                   first.getArea(),
+                                                   TokenTypes::IDENTIFIER,
+                                                   TokenTypes::SELF_TYPE,
+                                                   TokenTypes::L_PARANTHESIS});
+        }
+    }
+
     constexpr auto type(ast::Type&& already_parsed) noexcept
         -> std::expected<ast::Type, common::error::Error>
     {
-        if(type_lexer().next_is(lexing::TokenTypes::QUESTIONMARK)) {
+        auto token_res = type_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::move(already_parsed);
+        }
+
+        switch(token_res.value().getType()) {
+        case lexing::TokenTypes::QUESTIONMARK: {
             auto opt_res = optional_type(std::move(already_parsed));
             if(not opt_res) {
                 return opt_res;
@@ -68,7 +78,7 @@ private:
             return type(std::move(opt_res.value()));
         }
 
-        if(type_lexer().next_is(lexing::TokenTypes::LAMBDA_ARROW)) {
+        case lexing::TokenTypes::LAMBDA_ARROW: {
             auto lambda_res = simple_lambda_type(std::move(already_parsed));
             if(not lambda_res) {
                 return lambda_res;
@@ -77,7 +87,9 @@ private:
             return type(std::move(lambda_res.value()));
         }
 
-        return std::move(already_parsed);
+        default:
+            return std::move(already_parsed);
+        }
     }
 
     constexpr auto self_type() noexcept
@@ -141,7 +153,7 @@ private:
         using common::error::UnexpectedToken;
         using lexing::TokenTypes;
 
-        std::vector<ast::Type> types;
+        ast::TypeList types;
         types.emplace_back(std::move(first_type));
 
         while(type_lexer().pop_next_is(lexing::TokenTypes::BITWISE_AND)) {
@@ -170,7 +182,8 @@ private:
         auto area = lexing::TextArea::combine(start, end_token.getArea());
 
         return ast::Type{
-            forward<ast::TupleType>(std::move(area),
+            forward<ast::TupleType>(type_arena(),
+                                    std::move(area),
                                     std::move(types))};
     }
 
@@ -181,7 +194,7 @@ private:
         using common::error::UnexpectedToken;
         using lexing::TokenTypes;
 
-        std::vector<ast::Type> types;
+        ast::TypeList types;
         types.emplace_back(std::move(first_type));
 
         while(type_lexer().pop_next_is(lexing::TokenTypes::BITWISE_OR)) {
@@ -208,7 +221,8 @@ private:
         auto area = lexing::TextArea::combine(start, end_token.getArea());
 
         return ast::Type{
-            forward<ast::UnionType>(std::move(area),
+            forward<ast::UnionType>(type_arena(),
+                                    std::move(area),
                                     std::move(types))};
     }
 
@@ -270,7 +284,8 @@ private:
         auto area = lexing::TextArea::combine(start, ast::getTextArea(return_type));
 
         return ast::Type{
-            forward<ast::LambdaType>(std::move(area),
+            forward<ast::LambdaType>(type_arena(),
+                                     std::move(area),
                                      std::move(types),
                                      std::move(return_type))};
     }
@@ -317,35 +332,36 @@ private:
 
         auto first_type = std::move(first_type_res.value());
 
+        auto token_res = type_lexer().peek();
+        if(not token_res.has_value()) {
+            return std::unexpected(std::move(token_res.error()));
+        }
+        auto token = std::move(token_res.value());
+
+        switch(token.getType()) {
         // the type is a grouped type
-        if(type_lexer().next_is(lexing::TokenTypes::R_PARANTHESIS)) {
+        case TokenTypes::R_PARANTHESIS:
             return grouped_type(start_area, std::move(first_type));
-        }
 
         // the type is a tuple
-        if(type_lexer().next_is(lexing::TokenTypes::BITWISE_AND)) {
+        case TokenTypes::BITWISE_AND:
             return tuple_type(start_area, std::move(first_type));
-        }
 
         // the type is a union
-        if(type_lexer().next_is(lexing::TokenTypes::BITWISE_OR)) {
+        case TokenTypes::BITWISE_OR:
             return union_type(start_area, std::move(first_type));
-        }
 
         // the type is a lambda tpye with multiple parameters
-        if(type_lexer().next_is(lexing::TokenTypes::COMMA)) {
+        case TokenTypes::COMMA:
             return lambda_type_with_multiple(start_area, std::move(first_type));
+
+        default:
+            break;
         }
 
         // if we are here, we have an error
         // to be valid we should have read & or | or , or )
-        // so we get the token and create an error
-
-        auto token_res = type_lexer().peek_and_pop();
-        if(not token_res.has_value()) {
-            return std::unexpected(std::move(token_res.error()));
-        }
-        auto token = std::move(token_res.value());
+        type_lexer().pop();
 
         UnexpectedToken error{token.getType(),
                               token.getArea(),
@@ -383,7 +399,8 @@ private:
         auto area = lexing::TextArea::combine(start, end);
 
         return ast::Type{
-            forward<ast::OptionalType>(std::move(area),
+            forward<ast::OptionalType>(type_arena(),
+                                       std::move(area),
                                        std::move(first_type))};
     }
 
@@ -409,15 +426,21 @@ private:
                                               ast::getTextArea(ret_type));
 
         return ast::Type{
-            forward<ast::LambdaType>(area,
+            forward<ast::LambdaType>(type_arena(),
+                                     area,
                                      std::move(first_type),
                                      std::move(ret_type))};
     }
 
 private:
-    constexpr auto type_lexer() noexcept -> lexing::Lexer&
+    constexpr auto type_lexer() noexcept -> lexing::TokenCursor&
     {
         return static_cast<T*>(this)->lexer_;
     }
+
+    constexpr auto type_arena() noexcept -> ast::Arena*
+    {
+        return static_cast<T*>(this)->arena_;
+    }
 };
 } // namespace parser
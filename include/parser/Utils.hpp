@@ -1,6 +1,8 @@
 #pragma once
 
+#include <common/Error.hpp>
 #include <cstdlib>
+#include <lexer/TokenCursor.hpp>
 #include <optional>
 #include <string_view>
 
@@ -23,6 +25,20 @@ constexpr auto parse_int_unsafe(std::string_view str) noexcept
     return value;
 }
 
+// error for the next token of the lexer which is none of the expected tokens
+template<class... Expected>
+constexpr auto unexpected_next_token(lexing::TokenCursor& lexer, Expected... expected) noexcept
+    -> common::error::Error
+{
+    auto token_res = lexer.peek();
+    if(not token_res.has_value()) {
+        return token_res.error();
+    }
+    auto token = token_res.value();
+
+    return common::error::UnexpectedToken{token.getType(), token.getArea(), expected...};
+}
+
 constexpr auto parse_double_unsafe(std::string_view str) noexcept
     -> double
 {
@@ -0,0 +1,163 @@
+#include <ast/Arena.hpp>
+#include <ast/Forward.hpp>
+#include <common/Interner.hpp>
+#include <parser/Parser.hpp>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using parser::Parser;
+
+namespace {
+
+struct Counted
+{
+    explicit Counted(int* destroyed) noexcept
+        : destroyed_(destroyed) {}
+
+    ~Counted() noexcept
+    {
+        (*destroyed_)++;
+    }
+
+    int* destroyed_;
+};
+
+} // namespace
+
+TEST(ArenaTest, CreateAndReleaseTest)
+{
+    int destroyed = 0;
+
+    {
+        ast::Arena arena;
+
+        auto* first = arena.create<Counted>(&destroyed);
+        auto* second = arena.create<Counted>(&destroyed);
+        auto* number = arena.create<double>(3.1415);
+
+        EXPECT_NE(first, second);
+        EXPECT_EQ(*number, 3.1415);
+        EXPECT_EQ(reinterpret_cast<std::uintptr_t>(number) % alignof(double), 0);
+        EXPECT_EQ(arena.get_allocation_count(), 3);
+        EXPECT_EQ(arena.get_block_count(), 1);
+        EXPECT_EQ(destroyed, 0);
+    }
+
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST(ArenaTest, LargeAllocationTest)
+{
+    ast::Arena arena;
+
+    auto* small = arena.allocate(16, 8);
+    auto* large = arena.allocate(2 * ast::Arena::max_block_size, 64);
+
+    EXPECT_NE(small, nullptr);
+    EXPECT_NE(large, nullptr);
+    EXPECT_EQ(reinterpret_cast<std::uintptr_t>(large) % 64, 0);
+    EXPECT_EQ(arena.get_block_count(), 2);
+}
+
+TEST(ArenaTest, ForwardOwnershipTest)
+{
+    ast::Arena arena;
+
+    ast::Arena* no_arena = nullptr;
+    auto heap = ast::forward<ast::Identifier>(no_arena, lexing::TextArea{0, 0}, "a");
+    auto in_arena = ast::forward<ast::Identifier>(&arena, lexing::TextArea{0, 0}, "a");
+
+    EXPECT_FALSE(heap.is_arena_owned());
+    EXPECT_TRUE(in_arena.is_arena_owned());
+    EXPECT_EQ(heap, in_arena);
+
+    auto moved = std::move(in_arena);
+    EXPECT_TRUE(moved.is_arena_owned());
+    EXPECT_EQ(moved->getValue(common::Interner::global()), "a");
+    EXPECT_EQ(arena.get_allocation_count(), 1);
+
+    // the owner is stored inside of the pointer
+    static_assert(sizeof(ast::Forward<ast::Identifier>) == sizeof(void*));
+}
+
+TEST(ArenaTest, MoveTest)
+{
+    int destroyed = 0;
+    ast::Arena arena;
+
+    auto* first = arena.create<Counted>(&destroyed);
+    ast::Arena moved{std::move(arena)};
+
+    EXPECT_EQ(moved.get_allocation_count(), 1);
+    EXPECT_EQ(moved.get_block_count(), 1);
+    EXPECT_EQ(arena.get_allocation_count(), 0);
+    EXPECT_EQ(arena.get_block_count(), 0);
+
+    // the moved from arena must not hand out memory of the blocks it gave away
+    auto* second = arena.create<Counted>(&destroyed);
+    auto* third = moved.create<Counted>(&destroyed);
+    EXPECT_NE(second, first);
+    EXPECT_NE(second, third);
+    EXPECT_EQ(arena.get_block_count(), 1);
+    EXPECT_EQ(moved.get_block_count(), 1);
+
+    std::vector<ast::Arena> arenas;
+    arenas.emplace_back(std::move(moved));
+    arenas.emplace_back();
+    EXPECT_EQ(arenas.front().get_allocation_count(), 2);
+    EXPECT_EQ(destroyed, 0);
+
+    arenas.clear();
+    EXPECT_EQ(destroyed, 2);
+}
+
+TEST(ArenaTest, ArenaParsedTreeEqualsHeapTreeTest)
+{
+    std::string_view text =
+        "{let a = computeSomething(first, 42, 3.1415) + 42\n"
+        "let b = if(a <= b) { => \"some string\" } else { => self }\n"
+        "let c = (x, y) => x * y - 3\n"
+        "let d = !flag && other || value.member != -4\n"
+        "=> (a, b, c, d)}";
+
+    ast::Arena arena;
+
+    auto heap_result = Parser{text}.expression();
+    auto arena_result = Parser{text, arena}.expression();
+
+    ASSERT_TRUE(heap_result.has_value());
+    ASSERT_TRUE(arena_result.has_value());
+    EXPECT_EQ(heap_result.value(), arena_result.value());
+
+    ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::BlockExpr>>(arena_result.value()));
+    EXPECT_TRUE(std::get<ast::Forward<ast::BlockExpr>>(arena_result.value()).is_arena_owned());
+    EXPECT_GT(arena.get_allocation_count(), 20);
+}
+
+TEST(ArenaTest, ResetTest)
+{
+    int destroyed = 0;
+    ast::Arena arena;
+
+    for(int i = 0; i < 1000; i++) {
+        arena.create<Counted>(&destroyed);
+    }
+    arena.allocate(2 * ast::Arena::max_block_size, 64);
+    EXPECT_GT(arena.get_block_count(), 1);
+
+    EXPECT_EQ(arena.get_allocation_count(), 1001);
+
+    arena.reset();
+    EXPECT_EQ(destroyed, 1000);
+    EXPECT_EQ(arena.get_block_count(), 1);
+    EXPECT_EQ(arena.get_allocation_count(), 0);
+    EXPECT_EQ(arena.get_allocated_bytes(), 0);
+
+    auto* reused = arena.create<Counted>(&destroyed);
+    EXPECT_NE(reused, nullptr);
+    EXPECT_EQ(arena.get_block_count(), 1);
+    EXPECT_EQ(arena.get_allocation_count(), 1);
+    EXPECT_EQ(arena.get_allocated_bytes(), sizeof(Counted));
+}
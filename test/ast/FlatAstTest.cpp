@@ -0,0 +1,186 @@
+#include <array>
+#include <ast/flat/FlatAst.hpp>
+#include <ast/flat/Flatten.hpp>
+#include <ast/flat/Node.hpp>
+#include <parser/Parser.hpp>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+using ast::flat::NodeKind;
+using parser::Parser;
+
+TEST(FlatAstTest, FlattenBinaryExpressionTest)
+{
+    auto expr = Parser{"a + 2 * -b"}.expression();
+    ASSERT_TRUE(expr.has_value());
+
+    ast::flat::FlatAst flat;
+    auto root = ast::flat::flatten(expr.value(), flat, common::Interner::global());
+
+    // children are added before their parents
+    EXPECT_EQ(root, flat.get_node_count() - 1);
+    ASSERT_EQ(flat.get_kind(root), NodeKind::ADDITION);
+
+    auto [lhs, rhs] = flat.get_pair(root);
+    ASSERT_EQ(flat.get_kind(lhs), NodeKind::IDENTIFIER);
+    EXPECT_EQ(flat.get_text(lhs), "a");
+
+    ASSERT_EQ(flat.get_kind(rhs), NodeKind::MULTIPLICATION);
+    auto [two, neg] = flat.get_pair(rhs);
+    ASSERT_EQ(flat.get_kind(two), NodeKind::INTEGER);
+    EXPECT_EQ(flat.get_integer(two), 2);
+
+    ASSERT_EQ(flat.get_kind(neg), NodeKind::UNARY_MINUS);
+    auto b = flat.get_operand(neg);
+    ASSERT_EQ(flat.get_kind(b), NodeKind::IDENTIFIER);
+    EXPECT_EQ(flat.get_text(b), "b");
+    EXPECT_EQ(flat.get_area(b), (lexing::TextArea{9, 10}));
+}
+
+TEST(FlatAstTest, FlattenBlockExpressionTest)
+{
+    std::string_view text =
+        "{let a: Int = f(1, 2.5, \"s\")\n"
+        "let b = (x, y) => x\n"
+        "=> (a, b, true)}";
+
+    auto expr = Parser{text}.expression();
+    ASSERT_TRUE(expr.has_value());
+
+    ast::flat::FlatAst flat;
+    auto root = ast::flat::flatten(expr.value(), flat, common::Interner::global());
+    ASSERT_EQ(flat.get_kind(root), NodeKind::BLOCK_EXPR);
+
+    const auto& block = flat.get_composite(root);
+    auto statements = flat.get_children(block.list);
+    ASSERT_EQ(statements.size(), 2);
+
+    ASSERT_EQ(flat.get_kind(statements[0]), NodeKind::LET_ASSIGNMENT);
+    const auto& let = flat.get_composite(statements[0]);
+    EXPECT_EQ(flat.get_text(let.first), "a");
+    ASSERT_EQ(flat.get_kind(let.second), NodeKind::NAMED_TYPE);
+    EXPECT_EQ(flat.get_text(flat.get_composite(let.second).first), "Int");
+
+    ASSERT_EQ(flat.get_kind(let.third), NodeKind::FUNCTION_CALL);
+    const auto& call = flat.get_composite(let.third);
+    EXPECT_EQ(flat.get_text(call.first), "f");
+    auto arguments = flat.get_children(call.list);
+    ASSERT_EQ(arguments.size(), 3);
+    EXPECT_EQ(flat.get_integer(arguments[0]), 1);
+    EXPECT_EQ(flat.get_kind(arguments[1]), NodeKind::DOUBLE);
+    EXPECT_EQ(flat.get_kind(arguments[2]), NodeKind::STRING);
+
+    const auto& lambda = flat.get_composite(flat.get_composite(statements[1]).third);
+    EXPECT_EQ(flat.get_children(lambda.list).size(), 2);
+    EXPECT_EQ(lambda.first, ast::flat::invalid_node);
+    EXPECT_EQ(flat.get_kind(flat.get_pair(flat.get_children(lambda.list)[0]).first), NodeKind::IDENTIFIER);
+
+    ASSERT_EQ(flat.get_kind(block.first), NodeKind::TUPLE_EXPR);
+    auto tuple = flat.get_list(block.first);
+    ASSERT_EQ(tuple.size(), 3);
+    EXPECT_TRUE(flat.get_boolean(tuple[2]));
+}
+
+TEST(FlatAstTest, SerializeRoundTripTest)
+{
+    auto expr = Parser{"if(a <= b) { => \"some string\" } else { => f(self, 4.2) }"}.expression();
+    ASSERT_TRUE(expr.has_value());
+
+    ast::flat::FlatAst flat;
+    auto root = ast::flat::flatten(expr.value(), flat, common::Interner::global());
+
+    auto bytes = flat.serialize();
+    auto restored = ast::flat::FlatAst::deserialize(bytes);
+
+    ASSERT_TRUE(restored.has_value());
+    EXPECT_EQ(restored.value(), flat);
+    EXPECT_EQ(restored->get_kind(root), NodeKind::IF_EXPR);
+
+    const auto& body = restored->get_composite(restored->get_composite(root).second);
+    EXPECT_EQ(restored->get_text(body.first), "\"some string\"");
+
+    // every kind of node the flattener produces passes the validation
+    auto block = Parser{"{let a: Int? = (x: Int, y) => -x.f(y) + 1\nlet b = (a, !c, 2.5)\n=> if(a) {=> b} elif(c) {=> self} else {=> \"s\"}}"}.expression();
+    ASSERT_TRUE(block.has_value());
+    ast::flat::FlatAst flat_block;
+    ast::flat::flatten(block.value(), flat_block, common::Interner::global());
+    EXPECT_EQ(ast::flat::FlatAst::deserialize(flat_block.serialize()), flat_block);
+
+    // truncated or trailing data is rejected
+    EXPECT_FALSE(ast::flat::FlatAst::deserialize(std::span{bytes}.first(bytes.size() - 1)).has_value());
+    bytes.emplace_back(std::byte{0});
+    EXPECT_FALSE(ast::flat::FlatAst::deserialize(bytes).has_value());
+    EXPECT_FALSE(ast::flat::FlatAst::deserialize({}).has_value());
+}
+
+TEST(FlatAstTest, DeserializeRejectsInvalidIndicesTest)
+{
+    const auto deserializes = [](const ast::flat::FlatAst& flat) {
+        return ast::flat::FlatAst::deserialize(flat.serialize()).has_value();
+    };
+    const lexing::TextArea area{0, 1};
+
+    ast::flat::FlatAst valid;
+    auto a = valid.add_text(NodeKind::IDENTIFIER, area, "a");
+    auto b = valid.add_integer(area, 1);
+    valid.add_pair(NodeKind::ADDITION, area, a, b);
+    EXPECT_TRUE(deserializes(valid));
+
+    // unknown kind
+    ast::flat::FlatAst kind;
+    kind.add_leaf(static_cast<NodeKind>(200), area);
+    EXPECT_FALSE(deserializes(kind));
+
+    // payloads outside of their pool
+    ast::flat::FlatAst text;
+    text.add_leaf(NodeKind::IDENTIFIER, area, 0);
+    EXPECT_FALSE(deserializes(text));
+
+    ast::flat::FlatAst pair;
+    pair.add_integer(area, 1);
+    pair.add_leaf(NodeKind::ADDITION, area, 0);
+    EXPECT_FALSE(deserializes(pair));
+
+    ast::flat::FlatAst operand;
+    operand.add_leaf(NodeKind::LOGICAL_NOT, area, 1);
+    EXPECT_FALSE(deserializes(operand));
+
+    // children which are not nodes
+    ast::flat::FlatAst child;
+    auto c = child.add_integer(area, 1);
+    child.add_pair(NodeKind::ADDITION, area, c, 7);
+    EXPECT_FALSE(deserializes(child));
+
+    ast::flat::FlatAst list;
+    const std::array<ast::flat::NodeId, 1> children{3};
+    list.add_list(NodeKind::TUPLE_EXPR, area, children);
+    EXPECT_FALSE(deserializes(list));
+
+    // children have to be added before their parents, which rules out cycles
+    ast::flat::FlatAst cycle;
+    cycle.add_leaf(NodeKind::LOGICAL_NOT, area, 0);
+    EXPECT_FALSE(deserializes(cycle));
+
+    ast::flat::FlatAst later;
+    later.add_pair(NodeKind::ADDITION, area, 1, 2);
+    later.add_integer(area, 1);
+    later.add_integer(area, 2);
+    EXPECT_FALSE(deserializes(later));
+
+    // invalid_node is allowed for optional children only
+    ast::flat::FlatAst optional;
+    auto d = optional.add_integer(area, 1);
+    optional.add_composite(NodeKind::BLOCK_EXPR, area, {}, d);
+    auto e = optional.add_text(NodeKind::IDENTIFIER, area, "e");
+    optional.add_pair(NodeKind::LAMBDA_PARAMETER, area, e, ast::flat::invalid_node);
+    EXPECT_TRUE(deserializes(optional));
+
+    ast::flat::FlatAst required;
+    required.add_pair(NodeKind::ADDITION, area, ast::flat::invalid_node, ast::flat::invalid_node);
+    EXPECT_FALSE(deserializes(required));
+
+    ast::flat::FlatAst missing_body;
+    missing_body.add_composite(NodeKind::BLOCK_EXPR, area, {}, ast::flat::invalid_node);
+    EXPECT_FALSE(deserializes(missing_body));
+}
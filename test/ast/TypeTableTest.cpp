@@ -0,0 +1,77 @@
+#include <ast/type/TypeTable.hpp>
+#include <parser/Parser.hpp>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+using ast::TypeKind;
+using parser::Parser;
+
+namespace {
+
+auto intern(ast::TypeTable& table, std::string_view text) -> ast::TypeId
+{
+    auto type = Parser{text}.type();
+    EXPECT_TRUE(type.has_value());
+    return table.intern(type.value());
+}
+
+} // namespace
+
+TEST(TypeTableTest, StructurallyEqualTypesShareIdTest)
+{
+    ast::TypeTable table;
+
+    EXPECT_EQ(intern(table, "foo::bar"), intern(table, "(foo::bar)"));
+    EXPECT_EQ(intern(table, "Self?"), intern(table, "(Self)?"));
+    EXPECT_EQ(intern(table, "(a, b)=>c"), intern(table, "((a, b)=>c)"));
+    EXPECT_EQ(intern(table, "(a&b?)"), intern(table, "(a&(b?))"));
+
+    EXPECT_NE(intern(table, "foo::bar"), intern(table, "bar"));
+    EXPECT_NE(intern(table, "(a&b)"), intern(table, "(b&a)"));
+    EXPECT_NE(intern(table, "a=>b=>c"), intern(table, "(a=>b)=>c"));
+    EXPECT_NE(intern(table, "Self"), intern(table, "Self?"));
+
+    // interning known types does not grow the table
+    const auto size = table.size();
+    intern(table, "(a, b)=>c");
+    intern(table, "foo::bar");
+    EXPECT_EQ(table.size(), size);
+}
+
+TEST(TypeTableTest, UnionNormalizationTest)
+{
+    ast::TypeTable table;
+
+    auto a_or_b = intern(table, "(a | b)");
+    ASSERT_EQ(table.get_kind(a_or_b), TypeKind::UNION);
+    EXPECT_EQ(table.get_operands(a_or_b).size(), 2);
+
+    EXPECT_EQ(a_or_b, intern(table, "(b | a)"));
+    EXPECT_EQ(a_or_b, intern(table, "(a | b | a)"));
+    EXPECT_EQ(a_or_b, intern(table, "(b | (a | b))"));
+    EXPECT_EQ(intern(table, "(a | a)"), intern(table, "a"));
+    EXPECT_NE(a_or_b, intern(table, "(a | b?)"));
+
+    // unions are normalized wherever they appear
+    EXPECT_EQ(intern(table, "(a | b)=>c"), intern(table, "(b | a)=>c"));
+}
+
+TEST(TypeTableTest, OperandsTest)
+{
+    ast::TypeTable table;
+
+    auto lambda = intern(table, "(a, Self)=>c?");
+    ASSERT_EQ(table.get_kind(lambda), TypeKind::LAMBDA);
+
+    auto operands = table.get_operands(lambda);
+    ASSERT_EQ(operands.size(), 3);
+    EXPECT_EQ(table.get_kind(operands[0]), TypeKind::NAMED);
+    EXPECT_EQ(table.get_kind(operands[1]), TypeKind::SELF);
+    EXPECT_EQ(table.get_kind(operands[2]), TypeKind::OPTIONAL);
+
+    auto named = table.get_operands(intern(table, "foo::bar"));
+    ASSERT_EQ(named.size(), 2);
+    EXPECT_EQ(common::Interner::global().lookup(common::Symbol{named[0]}), "foo");
+    EXPECT_EQ(common::Interner::global().lookup(common::Symbol{named[1]}), "bar");
+}
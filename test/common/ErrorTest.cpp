@@ -0,0 +1,90 @@
+#include <common/Diagnostic.hpp>
+#include <common/Error.hpp>
+#include <lexer/LineIndex.hpp>
+#include <lexer/TokenSet.hpp>
+#include <parser/Parser.hpp>
+#include <string>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using lexing::TokenSet;
+using lexing::TokenTypes;
+
+TEST(ErrorTest, TokenSetTest)
+{
+    TokenSet set{TokenTypes::COMMA, TokenTypes::LET, TokenTypes::END_OF_FILE};
+
+    EXPECT_EQ(set.size(), 3);
+    EXPECT_TRUE(set.contains(TokenTypes::LET));
+    EXPECT_TRUE(set.contains(TokenTypes::END_OF_FILE));
+    EXPECT_FALSE(set.contains(TokenTypes::IDENTIFIER));
+
+    set.insert(TokenTypes::IDENTIFIER);
+    EXPECT_TRUE(set.contains(TokenTypes::IDENTIFIER));
+    EXPECT_EQ(set, (TokenSet{TokenTypes::COMMA, TokenTypes::LET} | TokenSet{TokenTypes::END_OF_FILE, TokenTypes::IDENTIFIER}));
+
+    // types are visited in declaration order
+    std::vector<TokenTypes> visited;
+    set.for_each([&](TokenTypes type) { visited.emplace_back(type); });
+    EXPECT_EQ(visited, (std::vector{TokenTypes::LET, TokenTypes::COMMA, TokenTypes::IDENTIFIER, TokenTypes::END_OF_FILE}));
+
+    EXPECT_TRUE(TokenSet{}.empty());
+}
+
+TEST(ErrorTest, RenderTest)
+{
+    std::string source = "let a = 1\nlet b = )";
+    lexing::LineIndex lines{source};
+
+    common::error::Error single = common::error::UnexpectedToken{TokenTypes::R_PARANTHESIS,
+                                                                 lexing::TextArea{18, 19},
+                                                                 TokenTypes::IDENTIFIER};
+    EXPECT_EQ(common::error::render(single, lines), "2:9: unexpected R_PARANTHESIS, expected IDENTIFIER");
+
+    common::error::Error multiple = common::error::UnexpectedToken{TokenTypes::R_PARANTHESIS,
+                                                                   lexing::TextArea{18, 19},
+                                                                   TokenTypes::COMMA,
+                                                                   TokenTypes::IDENTIFIER};
+    EXPECT_EQ(common::error::render(multiple, lines), "2:9: unexpected R_PARANTHESIS, expected one of COMMA, IDENTIFIER");
+
+    common::error::Error nesting = common::error::NestingTooDeep{lexing::TextArea{4, 5}, 256};
+    EXPECT_EQ(common::error::render(nesting, lines), "1:5: nested deeper than 256 levels");
+
+    common::error::Error lambda = common::error::InvalidLambdaParameter{lexing::TextArea{10, 19}};
+    EXPECT_EQ(common::error::render(lambda, lines),
+              "2:1: lambda parameters have to be identifiers, typed parameters have to be enclosed by ()");
+
+    common::error::Error too_large = common::error::SourceTooLarge{std::size_t{5} << 30};
+    EXPECT_EQ(common::error::render(too_large, lines),
+              "source of 5368709120 bytes is larger than the maximum of 4294967295 bytes");
+}
+
+TEST(ErrorTest, ParserErrorTest)
+{
+    auto result = parser::Parser{"let"}.expression();
+    ASSERT_FALSE(result.has_value());
+    ASSERT_TRUE(std::holds_alternative<common::error::UnexpectedToken>(result.error()));
+
+    const auto& error = std::get<common::error::UnexpectedToken>(result.error());
+    EXPECT_EQ(error.getActual(), TokenTypes::LET);
+    EXPECT_TRUE(error.getExpected().contains(TokenTypes::IDENTIFIER));
+    EXPECT_TRUE(error.getExpected().contains(TokenTypes::L_PARANTHESIS));
+}
+
+TEST(ErrorTest, SubParserErrorTest)
+{
+    auto render = [](std::string_view text) {
+        auto result = parser::Parser{text}.expression();
+        EXPECT_FALSE(result.has_value());
+        return result.has_value() ? std::string{} : common::error::render(result.error(), lexing::LineIndex{text});
+    };
+
+    EXPECT_EQ(render("if(a) b"), "1:8: unexpected <EOF>, expected one of ELSE, ELIF");
+    EXPECT_EQ(render("(a, b"), "1:6: unexpected <EOF>, expected one of R_PARANTHESIS, COMMA");
+    EXPECT_EQ(render("{=> a let"), "1:7: unexpected LET, expected R_BRACKET");
+    EXPECT_EQ(render("(a + b) => b"),
+              "1:1: lambda parameters have to be identifiers, typed parameters have to be enclosed by ()");
+    EXPECT_EQ(render("a: Int => a"),
+              "1:1: lambda parameters have to be identifiers, typed parameters have to be enclosed by ()");
+}
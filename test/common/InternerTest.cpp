@@ -0,0 +1,108 @@
+#include <ast/common/Identifier.hpp>
+#include <common/Interner.hpp>
+#include <cstdint>
+#include <limits>
+#include <parser/Parser.hpp>
+#include <string>
+#include <tbb/parallel_for.h>
+#include <unordered_set>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(InternerTest, InternAndLookupTest)
+{
+    common::Interner interner;
+
+    auto a = interner.intern("some_name");
+    auto b = interner.intern("other_name");
+    auto c = interner.intern(std::string{"some_"} + "name");
+
+    EXPECT_EQ(a, c);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(interner.lookup(a), "some_name");
+    EXPECT_EQ(interner.lookup(b), "other_name");
+    EXPECT_EQ(interner.size(), 2);
+
+    // the interned names do not depend on the lifetime of the input
+    std::string temporary = "temporary";
+    auto t = interner.intern(temporary);
+    temporary = "overwritten";
+    EXPECT_EQ(interner.lookup(t), "temporary");
+}
+
+TEST(InternerTest, ConcurrentInternTest)
+{
+    common::Interner interner;
+
+    constexpr std::size_t name_count = 1000;
+    constexpr std::size_t rounds = 8;
+    std::vector<std::uint32_t> ids(name_count * rounds);
+
+    // every name is interned by several tasks at the same time
+    tbb::parallel_for(std::size_t{0}, ids.size(), [&](std::size_t i) {
+        ids[i] = interner.intern("name_" + std::to_string(i % name_count)).get_id();
+    });
+
+    EXPECT_EQ(interner.size(), name_count);
+
+    std::unordered_set<std::uint32_t> distinct;
+    for(std::size_t i = 0; i < name_count; i++) {
+        distinct.insert(ids[i]);
+        EXPECT_EQ(interner.lookup(common::Symbol{ids[i]}), "name_" + std::to_string(i));
+
+        for(std::size_t round = 1; round < rounds; round++) {
+            EXPECT_EQ(ids[i], ids[i + round * name_count]);
+        }
+    }
+
+    EXPECT_EQ(distinct.size(), name_count);
+}
+
+TEST(InternerTest, IdentifierSymbolTest)
+{
+    ast::Identifier a{{0, 1}, "a"};
+    ast::Identifier other_a{{5, 6}, "a"};
+    ast::Identifier b{{2, 3}, "b"};
+
+    EXPECT_EQ(a, other_a);
+    EXPECT_NE(a, b);
+    EXPECT_EQ(a.getSymbol(), other_a.getSymbol());
+    EXPECT_EQ(std::hash<ast::Identifier>{}(a), std::hash<ast::Identifier>{}(other_a));
+    EXPECT_EQ(b.getValue(common::Interner::global()), "b");
+}
+
+TEST(InternerTest, ScopedInternerTest)
+{
+    common::Interner interner;
+
+    auto result = parser::Parser{"let some_scoped_name = other_scoped_name"}.set_interner(interner).toplevel();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(interner.size(), 2);
+
+    const auto& let = std::get<ast::Forward<ast::LetAssignment>>(result.value().front());
+    EXPECT_EQ(let->getName().getValue(interner), "some_scoped_name");
+
+    interner.clear();
+    EXPECT_EQ(interner.size(), 0);
+    EXPECT_EQ(interner.lookup(interner.intern("again")), "again");
+    EXPECT_EQ(interner.size(), 1);
+}
+
+TEST(InternerTest, SymbolOverflowTest)
+{
+    using common::Interner;
+
+    const auto last_shard = Interner::shard_count - 1;
+    EXPECT_EQ(Interner::make_id(0, last_shard), last_shard);
+    EXPECT_EQ(Interner::make_id(Interner::max_shard_size - 1, last_shard), std::numeric_limits<std::uint32_t>::max());
+
+    // the index would wrap around and collide with the first names of the shard
+    EXPECT_FALSE(Interner::make_id(Interner::max_shard_size, 0).has_value());
+    EXPECT_FALSE(Interner::make_id(Interner::max_shard_size + 1, last_shard).has_value());
+
+    Interner interner;
+    auto symbol = interner.try_intern("name");
+    ASSERT_TRUE(symbol.has_value());
+    EXPECT_EQ(interner.intern("name"), symbol.value());
+}
@@ -0,0 +1,80 @@
+#include <common/MappedFile.hpp>
+#include <cstdio>
+#include <filesystem>
+#include <fstream>
+#include <lexer/Lexer.hpp>
+#include <string>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+auto write_temporary_file(const std::string& name, const std::string& content)
+    -> std::filesystem::path
+{
+    auto path = std::filesystem::temp_directory_path() / name;
+    std::ofstream{path, std::ios::binary} << content;
+    return path;
+}
+
+} // namespace
+
+TEST(MappedFileTest, MapsWholeFileTest)
+{
+    std::string source = "let x = \"some string\"\n";
+    for(int i = 0; i < 1000; i++) {
+        source += "let y = x + " + std::to_string(i) + "\n";
+    }
+
+    auto path = write_temporary_file("neon_mapped_file_test.neon", source);
+    auto file = common::MappedFile::open(path.c_str());
+    ASSERT_TRUE(file.has_value());
+
+    EXPECT_EQ(file.value().content(), source);
+
+    // the mapping can be lexed directly
+    auto buffer = lexing::Lexer{file.value().content()}.tokenize_all();
+    ASSERT_FALSE(buffer.hasError());
+    EXPECT_EQ(buffer[3].getValue(file.value().content()), "\"some string\"");
+
+    // moving the mapping does not move the content
+    const auto* data = file.value().content().data();
+    auto moved = std::move(file.value());
+    EXPECT_EQ(moved.content().data(), data);
+    EXPECT_TRUE(file.value().content().empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, EmptyFileTest)
+{
+    auto path = write_temporary_file("neon_mapped_file_empty_test.neon", "");
+    auto file = common::MappedFile::open(path.c_str());
+
+    ASSERT_TRUE(file.has_value());
+    EXPECT_TRUE(file.value().content().empty());
+
+    std::filesystem::remove(path);
+}
+
+TEST(MappedFileTest, MissingFileTest)
+{
+    auto file = common::MappedFile::open("/this/file/does/not/exist.neon");
+
+    ASSERT_FALSE(file.has_value());
+    EXPECT_EQ(file.error(), std::errc::no_such_file_or_directory);
+}
+
+TEST(MappedFileTest, FileTooLargeTest)
+{
+    // a sparse file which does not occupy any disk space
+    auto path = write_temporary_file("neon_mapped_file_too_large_test.neon", "");
+    std::filesystem::resize_file(path, lexing::max_source_size + 1);
+
+    auto file = common::MappedFile::open(path.c_str());
+
+    ASSERT_FALSE(file.has_value());
+    EXPECT_EQ(file.error(), std::errc::file_too_large);
+
+    std::filesystem::remove(path);
+}
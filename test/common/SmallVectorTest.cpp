@@ -0,0 +1,107 @@
+#include <common/SmallVector.hpp>
+#include <memory>
+#include <parser/Parser.hpp>
+#include <string>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+TEST(SmallVectorTest, InlineAndGrowTest)
+{
+    common::SmallVector<std::string, 2> vec;
+    EXPECT_TRUE(vec.empty());
+    EXPECT_TRUE(vec.is_inline());
+
+    vec.emplace_back("first");
+    vec.push_back(std::string(64, 'x'));
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec.size(), 2);
+
+    vec.emplace_back("third");
+    EXPECT_FALSE(vec.is_inline());
+    EXPECT_EQ(vec.size(), 3);
+    EXPECT_GE(vec.capacity(), 3);
+
+    EXPECT_EQ(vec.front(), "first");
+    EXPECT_EQ(vec[1], std::string(64, 'x'));
+    EXPECT_EQ(vec.back(), "third");
+
+    vec.pop_back();
+    EXPECT_EQ(vec.size(), 2);
+    EXPECT_EQ(vec.back(), std::string(64, 'x'));
+}
+
+TEST(SmallVectorTest, EmplaceOwnElementTest)
+{
+    common::SmallVector<std::string, 2> vec;
+    vec.emplace_back(std::string(64, 'a'));
+    vec.emplace_back(std::string(64, 'b'));
+
+    // the referenced elements are moved to the heap while the new elements are added
+    vec.emplace_back(vec[0]);
+    vec.emplace_back(vec.back());
+    vec.emplace_back(vec[1]);
+
+    ASSERT_EQ(vec.size(), 5);
+    EXPECT_EQ(vec[2], std::string(64, 'a'));
+    EXPECT_EQ(vec[3], std::string(64, 'a'));
+    EXPECT_EQ(vec[4], std::string(64, 'b'));
+}
+
+TEST(SmallVectorTest, MoveTest)
+{
+    common::SmallVector<std::unique_ptr<int>, 2> small;
+    small.emplace_back(std::make_unique<int>(1));
+
+    auto moved_small = std::move(small);
+    EXPECT_TRUE(moved_small.is_inline());
+    ASSERT_EQ(moved_small.size(), 1);
+    EXPECT_EQ(*moved_small[0], 1);
+    EXPECT_TRUE(small.empty());
+
+    common::SmallVector<std::unique_ptr<int>, 2> large;
+    for(int i = 0; i < 5; i++) {
+        large.emplace_back(std::make_unique<int>(i));
+    }
+    auto* data = large.data();
+
+    // heap storage is handed over without moving the elements
+    moved_small = std::move(large);
+    EXPECT_EQ(moved_small.data(), data);
+    EXPECT_EQ(moved_small.size(), 5);
+    EXPECT_TRUE(large.empty());
+    EXPECT_TRUE(large.is_inline());
+
+    large.emplace_back(std::make_unique<int>(42));
+    EXPECT_EQ(*large.back(), 42);
+}
+
+TEST(SmallVectorTest, FromVectorAndEqualityTest)
+{
+    std::vector<std::string> source{"a", "b", "c"};
+    common::SmallVector<std::string, 4> vec{std::move(source)};
+    EXPECT_TRUE(vec.is_inline());
+    EXPECT_EQ(vec.size(), 3);
+
+    common::SmallVector<std::string, 4> other;
+    other.emplace_back("a");
+    other.emplace_back("b");
+    EXPECT_NE(vec, other);
+
+    other.emplace_back("c");
+    EXPECT_EQ(vec, other);
+}
+
+TEST(SmallVectorTest, ShortChildListsStayInlineTest)
+{
+    auto call = parser::Parser{"foo(a, b)"}.expression();
+    ASSERT_TRUE(call.has_value());
+    ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::FunctionCall>>(call.value()));
+    EXPECT_TRUE(std::get<ast::Forward<ast::FunctionCall>>(call.value())->getArguments().is_inline());
+
+    auto type = parser::Parser{"(a | b)"}.type();
+    ASSERT_TRUE(type.has_value());
+    ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::UnionType>>(type.value()));
+    EXPECT_TRUE(std::get<ast::Forward<ast::UnionType>>(type.value())->getTypes().is_inline());
+}
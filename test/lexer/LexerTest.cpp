@@ -35,6 +35,7 @@ TEST(LexerTest, SingleTokenTest)
     assertStringToLexedToken("3.1415e19", lexing::TokenTypes::DOUBLE);
     assertStringToLexedToken("type", lexing::TokenTypes::TYPE);
     assertStringToLexedToken("typeclass", lexing::TokenTypes::TYPECLASS);
+    assertStringToLexedToken("namespace", lexing::TokenTypes::NAMESPACE);
     assertStringToLexedToken("\n", lexing::TokenTypes::NEWLINE);
     assertStringToLexedToken("\n\n\n\n", lexing::TokenTypes::NEWLINE);
     assertStringToLexedToken("//", lexing::TokenTypes::LINE_COMMENT_START);
@@ -115,6 +116,26 @@ TEST(LexerTest, IdentifierTest)
     assertStringToLexedToken("_true_", lexing::TokenTypes::IDENTIFIER);
 }
 
+TEST(LexerTest, KeywordTableTest)
+{
+    for(const auto& keyword : lexing::keywords) {
+        const std::string text{keyword.text};
+
+        assertStringToLexedToken(text, keyword.type);
+        assertStringToLexedToken(text + " ", keyword.type);
+        assertStringToLexedToken(text + "(", keyword.type);
+        assertStringToLexedToken(text + "a", lexing::TokenTypes::IDENTIFIER);
+        assertStringToLexedToken(text + "_", lexing::TokenTypes::IDENTIFIER);
+        assertStringToLexedToken(text + "1", lexing::TokenTypes::IDENTIFIER);
+        assertStringToLexedToken("x" + text, lexing::TokenTypes::IDENTIFIER);
+    }
+
+    assertStringToLexedToken("tru", lexing::TokenTypes::IDENTIFIER);
+    assertStringToLexedToken("tyep", lexing::TokenTypes::IDENTIFIER);
+    assertStringToLexedToken("elis", lexing::TokenTypes::IDENTIFIER);
+    assertStringToLexedToken("__", lexing::TokenTypes::IDENTIFIER);
+}
+
 TEST(LexerTest, WhitespaceSkipTest)
 {
     assertStringToLexedToken(" _let", lexing::TokenTypes::IDENTIFIER);
@@ -172,8 +193,8 @@ auto nextShouldBe(Lexer& lexer, lexing::TokenTypes expectedToken)
     lexer.pop();
 
     ASSERT_EQ(actualToken.value().getType(), expectedToken)
-        << "input string: \"" << actualToken.value().getValue()
-        << "\" did not yield expected lexer token: "
+        << "token at offset " << actualToken.value().getOffset()
+        << " did not yield expected lexer token: "
         << lexing::get_description(expectedToken) << "; returned token is: "
         << lexing::get_description(actualToken.value().getType());
 }
@@ -219,6 +240,37 @@ TEST(LexerTest, StringLexTest)
     assertStringToLexedToken(R"("this \t  is a string yes")", lexing::TokenTypes::STANDARD_STRING);
 }
 
+TEST(LexerTest, LongStringLexTest)
+{
+    // escapes and the closing " at every offset of the 16 and 32 byte blocks
+    for(std::size_t prefix = 0; prefix < 70; prefix++) {
+        auto content = "\"" + std::string(prefix, 'x') + R"(\"\\ escaped\")" + std::string(prefix, 'y') + "\"";
+        auto input = content + " after";
+
+        auto lexer = lexing::Lexer(input);
+        auto string = lexer.peek_and_pop();
+
+        ASSERT_TRUE(string.has_value()) << input;
+        EXPECT_EQ(string.value().getType(), lexing::TokenTypes::STANDARD_STRING);
+        EXPECT_EQ(string.value().getValue(input), content);
+        nextShouldBe(lexer, lexing::TokenTypes::IDENTIFIER);
+    }
+}
+
+TEST(LexerTest, UnclosedStringTest)
+{
+    const std::vector<std::string> inputs{"\"", "\"abc", R"("abc\")", R"("abc\)",
+                                          "\"" + std::string(100, 'a') + "\\\""};
+
+    for(const auto& input : inputs) {
+        auto lexer = lexing::Lexer(input);
+        auto result = lexer.peek();
+
+        ASSERT_FALSE(result.has_value()) << input;
+        EXPECT_TRUE(std::holds_alternative<common::error::UnclosedString>(result.error())) << input;
+    }
+}
+
 TEST(LexerTest, LineCommentTest)
 {
     auto input = R"(
@@ -232,3 +284,107 @@ TEST(LexerTest, LineCommentTest)
     nextShouldBe(lexer, lexing::TokenTypes::IDENTIFIER);
     nextShouldBe(lexer, lexing::TokenTypes::END_OF_FILE);
 }
+
+TEST(LexerTest, TokenAreaTest)
+{
+    auto lexer = lexing::Lexer{"a\n\n  bc;"};
+
+    auto a = lexer.peek_and_pop();
+    auto nl = lexer.peek_and_pop();
+    auto bc = lexer.peek_and_pop();
+    auto semicolon = lexer.peek_and_pop();
+
+    ASSERT_TRUE(a and nl and bc and semicolon);
+
+    EXPECT_EQ(a.value().getArea().getStart(), 0);
+    EXPECT_EQ(nl.value().getArea().getStart(), 1);
+    EXPECT_EQ(nl.value().getArea().getEnd(), 3);
+    EXPECT_EQ(bc.value().getArea().getStart(), 5);
+    EXPECT_EQ(bc.value().getValue("a\n\n  bc;"), "bc");
+    EXPECT_EQ(semicolon.value().getArea().getStart(), 7);
+}
+
+TEST(LexerTest, LookaheadOrderTest)
+{
+    auto lexer = lexing::Lexer{"a + b * c - d"};
+
+    auto first = lexer.peek<3>();
+    ASSERT_TRUE(first.has_value());
+    EXPECT_EQ(first.value()[0].getType(), lexing::TokenTypes::IDENTIFIER);
+    EXPECT_EQ(first.value()[1].getType(), lexing::TokenTypes::PLUS);
+    EXPECT_EQ(first.value()[2].getType(), lexing::TokenTypes::IDENTIFIER);
+    EXPECT_EQ(first.value()[2].getOffset(), 4);
+
+    lexer.pop();
+    EXPECT_TRUE(lexer.next_is(lexing::TokenTypes::PLUS));
+
+    // wraps around the end of the ring buffer
+    auto second = lexer.peek<8>();
+    ASSERT_TRUE(second.has_value());
+    EXPECT_EQ(second.value()[0].getType(), lexing::TokenTypes::PLUS);
+    EXPECT_EQ(second.value()[3].getType(), lexing::TokenTypes::IDENTIFIER);
+    EXPECT_EQ(second.value()[3].getOffset(), 8);
+    EXPECT_EQ(second.value()[4].getType(), lexing::TokenTypes::MINUS);
+    EXPECT_EQ(second.value()[7].getType(), lexing::TokenTypes::END_OF_FILE);
+
+    EXPECT_EQ(lexer.lookahead(4).value().getType(), lexing::TokenTypes::MINUS);
+    EXPECT_FALSE(lexer.lookahead(8).has_value());
+
+    lexer.pop<5>();
+    EXPECT_TRUE(lexer.pop_next_is(lexing::TokenTypes::IDENTIFIER));
+    EXPECT_TRUE(lexer.next_is(lexing::TokenTypes::END_OF_FILE));
+
+    // popping tokens which were never peeked at
+    auto unpeeked = lexing::Lexer{"a b c"};
+    unpeeked.pop<2>();
+    EXPECT_EQ(unpeeked.peek().value().getOffset(), 4);
+}
+
+TEST(LexerTest, CompactTokenTest)
+{
+    static_assert(sizeof(lexing::Token) <= 12);
+
+    std::string_view input = "let value = \"some string\"";
+    auto lexer = lexing::Lexer{input};
+
+    auto let = lexer.peek_and_pop();
+    auto value = lexer.peek_and_pop();
+    auto assign = lexer.peek_and_pop();
+    auto string = lexer.peek_and_pop();
+
+    ASSERT_TRUE(let and value and assign and string);
+
+    EXPECT_EQ(let.value().getValue(input), "let");
+    EXPECT_EQ(value.value().getValue(input), "value");
+    EXPECT_EQ(value.value().getOffset(), 4);
+    EXPECT_EQ(value.value().getLength(), 5);
+    EXPECT_EQ(assign.value().getValue(input), "=");
+    EXPECT_EQ(string.value().getValue(input), "\"some string\"");
+    EXPECT_EQ(string.value().getArea().getEnd(), input.size());
+}
+
+TEST(LexerTest, SourceTooLargeTest)
+{
+    // content is the start of a source which is too large, it is never read
+    const std::string_view content = "let x = 1";
+    const auto too_large = lexing::max_source_size + 1;
+
+    auto lexer = lexing::Lexer{content, 0, too_large};
+    auto token = lexer.peek();
+    ASSERT_FALSE(token.has_value());
+    ASSERT_TRUE(std::holds_alternative<common::error::SourceTooLarge>(token.error()));
+    EXPECT_EQ(std::get<common::error::SourceTooLarge>(token.error()).getSize(), too_large);
+
+    // the error is latched, every further token is the same error
+    lexer.pop();
+    EXPECT_FALSE(lexer.peek().has_value());
+
+    auto buffer = lexing::Lexer{content, 0, too_large}.tokenize_all();
+    EXPECT_TRUE(buffer.hasError());
+    EXPECT_EQ(buffer.size(), 0);
+
+    // sources up to the limit are lexed
+    auto fitting = lexing::Lexer{content, 0, lexing::max_source_size}.tokenize_all();
+    EXPECT_FALSE(fitting.hasError());
+    EXPECT_EQ(fitting.size(), 5);
+}
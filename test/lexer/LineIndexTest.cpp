@@ -0,0 +1,57 @@
+#include <lexer/LineIndex.hpp>
+#include <lexer/Lexer.hpp>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+using lexing::LineColumn;
+using lexing::LineIndex;
+
+TEST(LineIndexTest, LineColumnTest)
+{
+    std::string_view source = "let a = 1\n\n  let b = a\nb";
+    LineIndex index{source};
+
+    EXPECT_EQ(index.get_line_column(0), (LineColumn{1, 1}));
+    EXPECT_EQ(index.get_line_column(4), (LineColumn{1, 5}));
+    // the newline itself belongs to the line it ends
+    EXPECT_EQ(index.get_line_column(9), (LineColumn{1, 10}));
+    EXPECT_EQ(index.get_line_column(10), (LineColumn{2, 1}));
+    EXPECT_EQ(index.get_line_column(13), (LineColumn{3, 3}));
+    EXPECT_EQ(index.get_line_column(source.size() - 1), (LineColumn{4, 1}));
+    // the end of file is located behind the last character
+    EXPECT_EQ(index.get_line_column(source.size()), (LineColumn{4, 2}));
+
+    EXPECT_EQ(index.get_line_count(), 4);
+}
+
+TEST(LineIndexTest, EmptySourceTest)
+{
+    LineIndex index{""};
+
+    EXPECT_EQ(index.get_line_column(0), (LineColumn{1, 1}));
+    EXPECT_EQ(index.get_line_count(), 1);
+}
+
+TEST(LineIndexTest, TokenPositionsTest)
+{
+    std::string source;
+    for(std::size_t line = 0; line < 500; line++) {
+        source += std::string(line % 13, ' ') + "token\n";
+    }
+
+    LineIndex index{source};
+    lexing::Lexer lexer{source};
+
+    for(std::size_t line = 0; line < 500; line++) {
+        auto token = lexer.peek_and_pop();
+        ASSERT_TRUE(token.has_value());
+        ASSERT_EQ(token.value().getType(), lexing::TokenTypes::IDENTIFIER);
+
+        auto position = index.get_line_column(token.value().getArea().getStart());
+        EXPECT_EQ(position, (LineColumn{line + 1, line % 13 + 1}));
+
+        ASSERT_TRUE(lexer.pop_next_is(lexing::TokenTypes::NEWLINE));
+    }
+}
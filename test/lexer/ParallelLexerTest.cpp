@@ -0,0 +1,87 @@
+#include <lexer/Lexer.hpp>
+#include <lexer/ParallelLexer.hpp>
+#include <string>
+#include <string_view>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+auto expect_same_tokens(std::string_view source, std::size_t chunk_count) -> void
+{
+    auto serial = lexing::Lexer{source}.tokenize_all();
+    auto parallel = lexing::tokenize_parallel(source, chunk_count);
+
+    ASSERT_EQ(parallel.size(), serial.size()) << chunk_count << " chunks";
+    EXPECT_EQ(parallel.hasError(), serial.hasError()) << chunk_count << " chunks";
+
+    for(std::size_t i = 0; i < serial.size(); i++) {
+        ASSERT_EQ(parallel.getType(i), serial.getType(i)) << "token " << i << " with " << chunk_count << " chunks";
+        ASSERT_EQ(parallel.getOffset(i), serial.getOffset(i)) << "token " << i << " with " << chunk_count << " chunks";
+        ASSERT_EQ(parallel.getLength(i), serial.getLength(i)) << "token " << i << " with " << chunk_count << " chunks";
+    }
+}
+
+// strings which span multiple lines make chunk boundaries fall inside of them
+auto generate_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    for(std::size_t i = 0; i < lines; i++) {
+        switch(i % 5) {
+        case 0:
+            source += "let a" + std::to_string(i) + " = b + 42 * 3.5 // a \"comment\"\n";
+            break;
+        case 1:
+            source += "    let s = \"a string\n\n spanning // lines\n\"\n\n";
+            break;
+        case 2:
+            source += "\"\nlet x = \\\"\" + y\n";
+            break;
+        case 3:
+            source += "if(x <= 1) { => self }\n\n\n";
+            break;
+        default:
+            source += "    \t  \n";
+            break;
+        }
+    }
+    return source;
+}
+
+} // namespace
+
+TEST(ParallelLexerTest, SameTokensAsSerialLexingTest)
+{
+    auto source = generate_source(200);
+
+    for(std::size_t chunks = 1; chunks < 80; chunks++) {
+        expect_same_tokens(source, chunks);
+    }
+}
+
+TEST(ParallelLexerTest, ErrorTest)
+{
+    auto source = generate_source(100) + "let $ = 1\n" + generate_source(100);
+
+    for(std::size_t chunks = 1; chunks < 40; chunks++) {
+        expect_same_tokens(source, chunks);
+    }
+
+    auto unclosed = generate_source(100) + "let a = \"unclosed\n" + generate_source(4);
+    for(std::size_t chunks = 1; chunks < 40; chunks++) {
+        expect_same_tokens(unclosed, chunks);
+    }
+}
+
+TEST(ParallelLexerTest, SmallSourcesTest)
+{
+    for(std::string_view source : {"", "\n", "\n\n\n", "a", "a\nb\n", "\"\n\"\n\"\n"}) {
+        for(std::size_t chunks = 1; chunks < 8; chunks++) {
+            expect_same_tokens(source, chunks);
+        }
+    }
+
+    expect_same_tokens(generate_source(10), 0);
+    auto buffer = lexing::tokenize_parallel(generate_source(10));
+    EXPECT_EQ(buffer.getType(buffer.size() - 1), lexing::TokenTypes::END_OF_FILE);
+}
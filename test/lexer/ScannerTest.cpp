@@ -0,0 +1,167 @@
+#include <algorithm>
+#include <lexer/Scanners.hpp>
+#include <string>
+#include <string_view>
+#include <utility>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using lexing::scanners::detail::Kernel;
+
+namespace {
+
+auto all_kernels(Kernel scalar_kernel, Kernel sse2_kernel, Kernel avx2_kernel)
+    -> std::vector<Kernel>
+{
+    std::vector<Kernel> kernels{scalar_kernel};
+#ifdef NEON_LEXER_X86_KERNELS
+    kernels.emplace_back(sse2_kernel);
+    if(__builtin_cpu_supports("avx2")) {
+        kernels.emplace_back(avx2_kernel);
+    }
+#endif
+    return kernels;
+}
+
+auto runtime_whitespace_length(std::string_view text) -> std::size_t
+{
+    return lexing::scanners::whitespace_length(text);
+}
+
+// scanned by a dynamic initializer before main, the kernels have to be selected already
+const std::size_t static_init_length = runtime_whitespace_length(" \t  a");
+
+// runs every kernel on runs of all lengths up to 80 characters followed by a terminator
+// and checks that every kernel stops right at the terminator
+auto check_run_lengths(const std::vector<Kernel>& kernels, char run_char, char terminator)
+{
+    for(std::size_t length = 0; length < 80; length++) {
+        std::string text(length, run_char);
+        text += terminator;
+        text += std::string(40, run_char);
+
+        for(auto kernel : kernels) {
+            const auto* end = kernel(text.data(), text.data() + text.size());
+            EXPECT_EQ(end - text.data(), length)
+                << "run of " << length << " '" << run_char << "' terminated by " << static_cast<int>(terminator);
+        }
+
+        // the run reaches the end of the input
+        for(auto kernel : kernels) {
+            const auto* end = kernel(text.data(), text.data() + length);
+            EXPECT_EQ(end - text.data(), length);
+        }
+    }
+}
+
+} // namespace
+
+#ifdef NEON_LEXER_X86_KERNELS
+#define KERNELS(name) all_kernels(lexing::scanners::scalar::name, \
+                                  lexing::scanners::sse2::name,   \
+                                  lexing::scanners::avx2::name)
+#else
+#define KERNELS(name) all_kernels(lexing::scanners::scalar::name, nullptr, nullptr)
+#endif
+
+TEST(ScannerTest, WhitespaceKernelTest)
+{
+    auto kernels = KERNELS(whitespace);
+
+    for(char c : {' ', '\t', '\v', '\f', '\r'}) {
+        check_run_lengths(kernels, c, '\n');
+        check_run_lengths(kernels, c, 'a');
+        check_run_lengths(kernels, c, '\x80');
+    }
+}
+
+TEST(ScannerTest, IdentifierKernelTest)
+{
+    auto kernels = KERNELS(identifier);
+
+    for(char c : {'a', 'z', 'A', 'Z', '_', '0', '9'}) {
+        for(char terminator : {' ', '@', '[', '`', '{', '/', ':', '(', '\xC1', '\0'}) {
+            check_run_lengths(kernels, c, terminator);
+        }
+    }
+}
+
+TEST(ScannerTest, DigitKernelTest)
+{
+    auto kernels = KERNELS(digits);
+
+    for(char c : {'0', '5', '9'}) {
+        for(char terminator : {'.', '/', ':', 'a', 'e', ' ', '\xB0'}) {
+            check_run_lengths(kernels, c, terminator);
+        }
+    }
+}
+
+TEST(ScannerTest, StringSpecialKernelTest)
+{
+    auto kernels = KERNELS(string_special);
+
+    for(char c : {'a', ' ', '\n', '\'', '\x80'}) {
+        check_run_lengths(kernels, c, '\"');
+        check_run_lengths(kernels, c, '\\');
+    }
+}
+
+TEST(ScannerTest, NewlineKernelTest)
+{
+    std::string text;
+    for(std::size_t i = 0; i < 300; i++) {
+        text += (i * i) % 7 == 0 or i % 33 == 0 ? '\n' : static_cast<char>('a' + i % 26);
+    }
+
+    std::vector<std::uint32_t> expected;
+    for(std::size_t i = 0; i < text.size(); i++) {
+        if(text[i] == '\n') {
+            expected.emplace_back(i + 1);
+        }
+    }
+
+    using namespace lexing::scanners;
+    std::vector<std::pair<detail::CountKernel, detail::LineStartKernel>> kernels{
+        {scalar::count_newlines, scalar::line_starts}};
+#ifdef NEON_LEXER_X86_KERNELS
+    kernels.emplace_back(sse2::count_newlines, sse2::line_starts);
+    if(__builtin_cpu_supports("avx2")) {
+        kernels.emplace_back(avx2::count_newlines, avx2::line_starts);
+    }
+#endif
+
+    for(auto [count, starts] : kernels) {
+        // every length makes the scalar tail handle a different number of bytes
+        for(std::size_t length = 0; length <= text.size(); length++) {
+            const auto* begin = text.data();
+            const auto expected_count = std::count_if(expected.begin(), expected.end(),
+                                                      [&](auto start) { return start <= length; });
+
+            ASSERT_EQ(count(begin, begin + length), expected_count) << length;
+
+            std::vector<std::uint32_t> actual(expected_count);
+            auto* end = starts(begin, begin, begin + length, actual.data());
+            ASSERT_EQ(end, actual.data() + actual.size()) << length;
+            ASSERT_TRUE(std::equal(actual.begin(), actual.end(), expected.begin())) << length;
+        }
+    }
+}
+
+TEST(ScannerTest, RunLengthTest)
+{
+    EXPECT_EQ(lexing::scanners::whitespace_length(" \t  x"), 4);
+    EXPECT_EQ(lexing::scanners::identifier_length("some_identifier_42 + 1"), 18);
+    EXPECT_EQ(lexing::scanners::digits_length("1234567890.5"), 10);
+    EXPECT_EQ(lexing::scanners::digits_length(""), 0);
+    EXPECT_EQ(lexing::scanners::string_special_offset(R"(abc\"")"), 3);
+    EXPECT_EQ(lexing::scanners::string_special_offset("no quote"), 8);
+
+    static_assert(lexing::scanners::identifier_length("abc def") == 3);
+}
+
+TEST(ScannerTest, StaticInitializationTest)
+{
+    EXPECT_EQ(static_init_length, 4);
+}
@@ -0,0 +1,106 @@
+#include <lexer/Lexer.hpp>
+#include <lexer/TokenBuffer.hpp>
+#include <lexer/TokenCursor.hpp>
+#include <string_view>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+using lexing::TokenTypes;
+
+TEST(TokenBufferTest, TokenizeAllMatchesOnDemandLexingTest)
+{
+    std::string_view input = R"(
+        let value: Int = computeSomething(a, 42, 3.1415) // comment
+        if(a <= b) { => "some \"string\"" } else { => self }
+    )";
+
+    auto buffer = lexing::Lexer{input}.tokenize_all();
+    auto lexer = lexing::Lexer{input};
+
+    ASSERT_FALSE(buffer.hasError());
+    ASSERT_FALSE(buffer.empty());
+    EXPECT_EQ(buffer.getType(buffer.size() - 1), TokenTypes::END_OF_FILE);
+
+    for(std::size_t i = 0; i < buffer.size(); i++) {
+        auto expected = lexer.peek_and_pop();
+        ASSERT_TRUE(expected.has_value());
+
+        EXPECT_EQ(buffer.getType(i), expected.value().getType());
+        EXPECT_EQ(buffer.getOffset(i), expected.value().getOffset());
+        EXPECT_EQ(buffer.getLength(i), expected.value().getLength());
+        EXPECT_EQ(buffer[i].getValue(input), expected.value().getValue(input));
+    }
+}
+
+TEST(TokenBufferTest, TokenizeAllStopsAtErrorTest)
+{
+    auto buffer = lexing::Lexer{"a + \"unclosed"}.tokenize_all();
+
+    ASSERT_TRUE(buffer.hasError());
+    ASSERT_EQ(buffer.size(), 2);
+    EXPECT_EQ(buffer.getType(0), TokenTypes::IDENTIFIER);
+    EXPECT_EQ(buffer.getType(1), TokenTypes::PLUS);
+    EXPECT_TRUE(std::holds_alternative<common::error::UnclosedString>(buffer.getError().value()));
+}
+
+TEST(TokenBufferTest, CursorTest)
+{
+    std::string_view input = "a + b";
+    lexing::TokenCursor cursor{lexing::Lexer{input}.tokenize_all()};
+
+    auto three = cursor.peek<3>();
+    ASSERT_TRUE(three.has_value());
+    EXPECT_EQ(three.value()[0].getType(), TokenTypes::IDENTIFIER);
+    EXPECT_EQ(three.value()[1].getType(), TokenTypes::PLUS);
+    EXPECT_EQ(three.value()[2].getType(), TokenTypes::IDENTIFIER);
+    EXPECT_EQ(three.value()[2].getValue(input), "b");
+
+    EXPECT_TRUE(cursor.next_is(TokenTypes::IDENTIFIER));
+    EXPECT_FALSE(cursor.pop_next_is(TokenTypes::PLUS));
+    EXPECT_TRUE(cursor.pop_next_is(TokenTypes::IDENTIFIER));
+    EXPECT_TRUE(cursor.next_is_infix_operator());
+    EXPECT_EQ(cursor.get_current_position().getStart(), 2);
+
+    cursor.pop<2>();
+    EXPECT_TRUE(cursor.next_is(TokenTypes::END_OF_FILE));
+
+    // the end of the input can be peeked and popped any number of times
+    cursor.pop<3>();
+    auto eof = cursor.peek_and_pop<2>();
+    ASSERT_TRUE(eof.has_value());
+    EXPECT_EQ(eof.value()[1].getType(), TokenTypes::END_OF_FILE);
+    EXPECT_EQ(eof.value()[1].getOffset(), input.size());
+}
+
+TEST(TokenBufferTest, CursorCheckpointTest)
+{
+    lexing::TokenCursor cursor{lexing::Lexer{"(a, b) => a"}.tokenize_all()};
+    cursor.pop();
+
+    const auto checkpoint = cursor.checkpoint();
+    cursor.pop<5>();
+    EXPECT_TRUE(cursor.next_is(TokenTypes::IDENTIFIER));
+    EXPECT_EQ(cursor.get_current_position().getStart(), 10);
+
+    cursor.rewind(checkpoint);
+    EXPECT_TRUE(cursor.next_is(TokenTypes::IDENTIFIER));
+    EXPECT_EQ(cursor.get_current_position().getStart(), 1);
+    EXPECT_EQ(cursor.lookahead(1).value().getType(), TokenTypes::COMMA);
+}
+
+TEST(TokenBufferTest, CursorErrorTest)
+{
+    lexing::TokenCursor cursor{lexing::Lexer{"a $"}.tokenize_all()};
+
+    EXPECT_FALSE(cursor.peek<2>().has_value());
+    EXPECT_TRUE(cursor.pop_next_is(TokenTypes::IDENTIFIER));
+
+    auto error = cursor.peek();
+    ASSERT_FALSE(error.has_value());
+    EXPECT_TRUE(std::holds_alternative<common::error::UnknownToken>(error.error()));
+    EXPECT_FALSE(cursor.next_is(TokenTypes::END_OF_FILE));
+
+    cursor.pop();
+    EXPECT_FALSE(cursor.peek().has_value());
+}
@@ -14,25 +14,28 @@ inline auto id(std::string_view text) -> ast::Identifier
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto sub(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Substraction>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::SUBSTRACTION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto mul(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Multiplication>(lexing::TextArea{0, 0},
-                                          std::move(lhs),
-                                          std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MULTIPLICATION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 auto expr_test_positive(std::string_view text, auto expected)
@@ -35,32 +35,36 @@ inline auto block(auto e, auto... stmts) -> ast::Expression
 inline auto neg(auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::UnaryMinus>(lexing::TextArea{0, 0},
-                                      std::move(rhs))};
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::MINUS,
+                                          std::move(rhs))};
 }
 
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto access(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::MemberAccess>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MEMBER_ACCESS,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto mul(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Multiplication>(lexing::TextArea{0, 0},
-                                          std::move(lhs),
-                                          std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MULTIPLICATION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto expr_test_positive(std::string_view text, auto expected)
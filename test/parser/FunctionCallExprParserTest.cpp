@@ -14,16 +14,18 @@ inline auto id(std::string_view text) -> ast::Identifier
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto neg(auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::UnaryMinus>(lexing::TextArea{0, 0},
-                                      std::move(rhs))};
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::MINUS,
+                                          std::move(rhs))};
 }
 
 inline auto lambda(std::string_view param, auto rhs) -> ast::Expression
@@ -62,9 +64,10 @@ inline auto call(auto lhs, auto... rhs) -> ast::Expression
 inline auto access(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::MemberAccess>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MEMBER_ACCESS,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 auto expr_test_positive(std::string_view text, auto expected)
@@ -24,17 +24,19 @@ auto if_(auto condition, auto then, auto else_) -> ast::Expression
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto sub(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Substraction>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::SUBSTRACTION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 auto if_test_positive(std::string_view text, auto expected)
@@ -14,25 +14,28 @@ inline auto id(std::string_view text) -> ast::Identifier
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto sub(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Substraction>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::SUBSTRACTION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto mul(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Multiplication>(lexing::TextArea{0, 0},
-                                          std::move(lhs),
-                                          std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MULTIPLICATION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto lambda(std::string_view param, auto rhs) -> ast::Expression
@@ -49,6 +52,41 @@ inline auto lambda(std::string_view param, auto rhs) -> ast::Expression
 
 
 
+inline auto param(std::string_view name) -> ast::LambdaParameter
+{
+    return ast::LambdaParameter{ast::Identifier{{0, 0}, name}};
+}
+
+inline auto param(std::string_view name, std::string_view type) -> ast::LambdaParameter
+{
+    return ast::LambdaParameter{ast::Identifier{{0, 0}, name},
+                                ast::NamedType{{0, 0}, std::vector<ast::Identifier>{}, ast::Identifier{{0, 0}, type}}};
+}
+
+inline auto params(auto... elems) -> std::vector<ast::LambdaParameter>
+{
+    std::vector<ast::LambdaParameter> result;
+    (result.emplace_back(std::move(elems)), ...);
+    return result;
+}
+
+inline auto lambda(std::vector<ast::LambdaParameter> params, auto rhs) -> ast::Expression
+{
+    return ast::Expression{
+        ast::forward<ast::LambdaExpr>(lexing::TextArea{0, 0},
+                                      std::move(params),
+                                      std::move(rhs))};
+}
+
+inline auto tuple(auto... elems) -> ast::Expression
+{
+    std::vector<ast::Expression> exprs;
+    (exprs.emplace_back(std::move(elems)), ...);
+
+    return ast::Expression{
+        ast::forward<ast::TupleExpr>(lexing::TextArea{0, 0}, std::move(exprs))};
+}
+
 inline auto expr_test_positive(std::string_view text, auto expected)
 {
     auto result = Parser{text}.expression();
@@ -83,3 +121,37 @@ TEST(LambdaExprParserTest, SingleParamLambdaExprParserTest)
                                       id("l")),
                                   id("m"))));
 }
+
+inline auto expr_test_negative(std::string_view text)
+{
+    auto result = Parser{text}.expression();
+    EXPECT_FALSE(result.has_value()) << text;
+}
+
+TEST(LambdaExprParserTest, ParenthesizedLambdaExprParserTest)
+{
+    expr_test_positive("(a) => a", lambda(params(param("a")), id("a")));
+    expr_test_positive("(a, b) => a + b",
+                       lambda(params(param("a"), param("b")), add(id("a"), id("b"))));
+    expr_test_positive("(a: Int, b, c: Int) => a * c",
+                       lambda(params(param("a", "Int"), param("b"), param("c", "Int")),
+                              mul(id("a"), id("c"))));
+}
+
+// the lambda head is parsed speculatively, all of these have to be rewound
+TEST(LambdaExprParserTest, GroupedAndTupleExprParserTest)
+{
+    expr_test_positive("(a)", ast::Expression{id("a")});
+    expr_test_positive("(a + b)", add(id("a"), id("b")));
+    expr_test_positive("(a, b)", tuple(id("a"), id("b")));
+    expr_test_positive("(a, b + c)", tuple(id("a"), add(id("b"), id("c"))));
+    expr_test_positive("(a, (b, c))", tuple(id("a"), tuple(id("b"), id("c"))));
+    expr_test_positive("((a, b) => a, b)",
+                       tuple(lambda(params(param("a"), param("b")), id("a")), id("b")));
+
+    expr_test_negative("(a: Int)");
+    expr_test_negative("(a, b: Int)");
+    expr_test_negative("(a, 1) => b");
+    expr_test_negative("(a + b) => b");
+    expr_test_negative("(a, b");
+}
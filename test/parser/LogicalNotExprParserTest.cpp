@@ -14,45 +14,51 @@ inline auto id(std::string_view text) -> ast::Identifier
 inline auto neg(auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::UnaryMinus>(lexing::TextArea{0, 0},
-                                      std::move(rhs))};
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::MINUS,
+                                          std::move(rhs))};
 }
 inline auto pos(auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::UnaryPlus>(lexing::TextArea{0, 0},
-                                     std::move(rhs))};
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::PLUS,
+                                          std::move(rhs))};
 }
 inline auto no(auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::LogicalNot>(lexing::TextArea{0, 0},
-                                      std::move(rhs))};
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::LOGICAL_NOT,
+                                          std::move(rhs))};
 }
 
 
 inline auto add(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Addition>(lexing::TextArea{0, 0},
-                                    std::move(lhs),
-                                    std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::ADDITION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto access(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::MemberAccess>(lexing::TextArea{0, 0},
-                                        std::move(lhs),
-                                        std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MEMBER_ACCESS,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto mul(auto lhs, auto rhs) -> ast::Expression
 {
     return ast::Expression{
-        ast::forward<ast::Multiplication>(lexing::TextArea{0, 0},
-                                          std::move(lhs),
-                                          std::move(rhs))};
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           ast::BinaryOperator::MULTIPLICATION,
+                                           std::move(lhs),
+                                           std::move(rhs))};
 }
 
 inline auto expr_test_positive(std::string_view text, auto expected)
@@ -0,0 +1,125 @@
+#include <ast/Arena.hpp>
+#include <common/Error.hpp>
+#include <lexer/Lexer.hpp>
+#include <parser/Parser.hpp>
+#include <string>
+
+#include <gtest/gtest.h>
+
+using parser::Parser;
+
+inline auto id(std::string_view text) -> ast::Identifier
+{
+    return ast::Identifier{{0, 0}, text};
+}
+
+inline auto no(auto rhs) -> ast::Expression
+{
+    return ast::Expression{
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::LOGICAL_NOT,
+                                          std::move(rhs))};
+}
+
+inline auto neg(auto rhs) -> ast::Expression
+{
+    return ast::Expression{
+        ast::forward<ast::UnaryOperation>(lexing::TextArea{0, 0},
+                                          ast::UnaryOperator::MINUS,
+                                          std::move(rhs))};
+}
+
+inline auto binary(ast::BinaryOperator op, auto lhs, auto rhs) -> ast::Expression
+{
+    return ast::Expression{
+        ast::forward<ast::BinaryOperation>(lexing::TextArea{0, 0},
+                                           op,
+                                           std::move(lhs),
+                                           std::move(rhs))};
+}
+
+inline auto is_nesting_error(const auto& result) -> bool
+{
+    return not result.has_value()
+        and std::holds_alternative<common::error::NestingTooDeep>(result.error());
+}
+
+TEST(OperatorChainParserTest, MixedPrecedenceTest)
+{
+    using ast::BinaryOperator;
+
+    // every precedence level pushes one more pending operator
+    auto result = Parser{"a || b && c | d & e == f < g + h * -i.j"}.expression();
+    ASSERT_TRUE(result.has_value());
+
+    auto expected =
+        binary(BinaryOperator::LOGICAL_OR, id("a"),
+               binary(BinaryOperator::LOGICAL_AND, id("b"),
+                      binary(BinaryOperator::BITWISE_OR, id("c"),
+                             binary(BinaryOperator::BITWISE_AND, id("d"),
+                                    binary(BinaryOperator::EQUAL, id("e"),
+                                           binary(BinaryOperator::LESS_THEN, id("f"),
+                                                  binary(BinaryOperator::ADDITION, id("g"),
+                                                         binary(BinaryOperator::MULTIPLICATION, id("h"),
+                                                                neg(binary(BinaryOperator::MEMBER_ACCESS, id("i"), id("j")))))))))));
+
+    EXPECT_EQ(result.value(), expected);
+
+    auto reduced = Parser{"a * b + c * !d(e) - f"}.expression();
+    ASSERT_TRUE(reduced.has_value());
+    EXPECT_TRUE(std::holds_alternative<ast::Forward<ast::BinaryOperation>>(reduced.value()));
+    EXPECT_EQ(std::get<ast::Forward<ast::BinaryOperation>>(reduced.value())->getOperator(),
+              BinaryOperator::SUBSTRACTION);
+}
+
+TEST(OperatorChainParserTest, LongInfixChainTest)
+{
+    constexpr std::size_t terms = 100000;
+
+    std::string source = "a";
+    for(std::size_t i = 1; i < terms; i++) {
+        source += " + a";
+    }
+
+    // the left leaning tree is as deep as the chain is long,
+    // the arena releases it without recursing through it
+    ast::Arena arena;
+    auto result = Parser{source, arena}.expression();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::BinaryOperation>>(result.value()));
+
+    const auto& root = std::get<ast::Forward<ast::BinaryOperation>>(result.value());
+    EXPECT_EQ(root->getOperator(), ast::BinaryOperator::ADDITION);
+    EXPECT_EQ(root->getRightHandSide(), ast::Expression{id("a")});
+}
+
+TEST(OperatorChainParserTest, NestingLimitTest)
+{
+    auto nots = Parser{"!!!x"}.expression();
+    ASSERT_TRUE(nots.has_value());
+    EXPECT_EQ(nots.value(), no(no(no(id("x")))));
+
+    std::string prefixes(Parser::default_max_nesting_depth - 1, '!');
+    EXPECT_TRUE(Parser{prefixes + "x"}.expression().has_value());
+
+    std::string long_prefixes(100000, '!');
+    EXPECT_TRUE(is_nesting_error(Parser{long_prefixes + "x"}.expression()));
+
+    std::string parens(100000, '(');
+    EXPECT_TRUE(is_nesting_error(Parser{parens + "x"}.expression()));
+
+    EXPECT_TRUE(Parser{"((((x))))"}.set_max_nesting_depth(5).expression().has_value());
+    EXPECT_TRUE(is_nesting_error(Parser{"(((((x)))))"}.set_max_nesting_depth(5).expression()));
+    EXPECT_TRUE(is_nesting_error(Parser{"-!-!-x"}.set_max_nesting_depth(5).expression()));
+
+    // the error is returned through the sub parsers of blocks, ifs, lambdas and tuples
+    EXPECT_TRUE(is_nesting_error(Parser{"{=> (((x)))}"}.set_max_nesting_depth(3).expression()));
+    EXPECT_TRUE(is_nesting_error(Parser{"if((((a)))) b else c"}.set_max_nesting_depth(3).expression()));
+    EXPECT_TRUE(is_nesting_error(Parser{"a => b => c => d"}.set_max_nesting_depth(3).expression()));
+    EXPECT_TRUE(is_nesting_error(Parser{"(a, ((b)))"}.set_max_nesting_depth(3).expression()));
+
+    // a syntax error after a nested expression which stays below the limit is reported as it is
+    auto syntax_error = Parser{"((x)) + )"}.set_max_nesting_depth(3).expression();
+    ASSERT_FALSE(syntax_error.has_value());
+    EXPECT_TRUE(std::holds_alternative<common::error::UnexpectedToken>(syntax_error.error()));
+}
@@ -0,0 +1,95 @@
+#include <lexer/Lexer.hpp>
+#include <parser/ParallelParser.hpp>
+#include <parser/Parser.hpp>
+#include <string>
+#include <string_view>
+#include <utils/ToplevelUtils.hpp>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+auto expect_same_elements(std::string_view source, std::size_t segment_count) -> void
+{
+    SCOPED_TRACE(std::to_string(segment_count) + " segments");
+
+    ast::Arena arena;
+    auto serial = parser::Parser{source, arena}.toplevel();
+    auto parallel = parser::parse_parallel(source, lexing::Lexer{source}.tokenize_all(), segment_count);
+
+    if(not parallel.has_value()) {
+        tests::expect_same_elements(source, serial, {}, parallel.error());
+        return;
+    }
+    tests::expect_same_elements(source, serial, parallel.value().getElements(), std::nullopt);
+}
+
+} // namespace
+
+TEST(ParallelParserTest, ToplevelTest)
+{
+    auto result = parser::Parser{"\nlet a = 1; let b = a\n\nlet c = {let d = b\nlet e = d\n=> e}\n"}.toplevel();
+
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value().size(), 3);
+
+    auto error = parser::Parser{"let a = 1 let b = 2"}.toplevel();
+    ASSERT_FALSE(error.has_value());
+    EXPECT_EQ(tests::render("let a = 1 let b = 2", error.error()),
+              "1:11: unexpected LET, expected one of NEWLINE, SEMICOLON, <EOF>");
+
+    auto type = parser::Parser{"type T = Int"}.toplevel();
+    ASSERT_FALSE(type.has_value());
+    EXPECT_EQ(tests::render("type T = Int", type.error()), "1:1: unexpected TYPE, expected one of LET, FUN, NAMESPACE");
+}
+
+TEST(ParallelParserTest, SameElementsAsSerialParsingTest)
+{
+    auto source = tests::generate_toplevel_source(300);
+    ASSERT_TRUE(parser::Parser{source}.toplevel().has_value());
+
+    for(std::size_t segments = 1; segments < 40; segments++) {
+        expect_same_elements(source, segments);
+    }
+}
+
+TEST(ParallelParserTest, SplitOnlyAtToplevelElementsTest)
+{
+    auto source = tests::generate_toplevel_source(300);
+    auto tokens = lexing::Lexer{source}.tokenize_all();
+
+    auto boundaries = parser::detail::split_into_segments(tokens, 16);
+    EXPECT_GT(boundaries.size(), 8);
+    EXPECT_EQ(boundaries.back(), tokens.size());
+
+    for(std::size_t i = 1; i + 1 < boundaries.size(); i++) {
+        EXPECT_TRUE(parser::detail::starts_toplevel_element(tokens.getType(boundaries[i])));
+        EXPECT_TRUE(tokens[boundaries[i] - 1].isSeparator());
+        // elements inside of blocks and namespaces are never named like top level elements in the generated source
+        auto name = tokens[boundaries[i] + 1].getValue(source);
+        EXPECT_NE(name, "x");
+        EXPECT_NE(name, "y");
+        EXPECT_NE(name, "let_");
+        EXPECT_NE(name, "g");
+        EXPECT_NE(name, "inner");
+    }
+}
+
+TEST(ParallelParserTest, FirstErrorIsReportedTest)
+{
+    auto source = tests::generate_toplevel_source(200);
+    source += "let broken = (1 +\nlet x = 2\n";
+    source += tests::generate_toplevel_source(200);
+    source += "let also_broken = ) 1\n";
+    ASSERT_FALSE(parser::Parser{source}.toplevel().has_value());
+
+    for(std::size_t segments = 1; segments < 20; segments++) {
+        expect_same_elements(source, segments);
+    }
+
+    auto unclosed = tests::generate_toplevel_source(100) + "let s = \"never closed\n" + tests::generate_toplevel_source(100);
+    for(std::size_t segments = 1; segments < 10; segments++) {
+        expect_same_elements(unclosed, segments);
+    }
+}
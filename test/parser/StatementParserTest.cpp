@@ -0,0 +1,64 @@
+#include <ast/Ast.hpp>
+#include <common/Diagnostic.hpp>
+#include <lexer/LineIndex.hpp>
+#include <parser/Parser.hpp>
+#include <string>
+#include <string_view>
+#include <variant>
+
+#include <gtest/gtest.h>
+
+using parser::Parser;
+
+TEST(StatementParserTest, WhileStmtTest)
+{
+    for(std::string_view text : {"while true {\n1\n}", "while true {1}", "while a {\n\nlet b = a; b\n;\n}"}) {
+        auto result = Parser{text}.statement();
+        ASSERT_TRUE(result.has_value()) << text;
+        ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::WhileStmt>>(result.value())) << text;
+
+        const auto& stmt = std::get<ast::Forward<ast::WhileStmt>>(result.value());
+        EXPECT_EQ(stmt->getArea().getEnd(), text.size());
+    }
+
+    auto empty = Parser{"while true {}"}.statement();
+    ASSERT_TRUE(empty.has_value());
+    EXPECT_TRUE(std::get<ast::Forward<ast::WhileStmt>>(empty.value())->getBody().empty());
+
+    // inside of nested expressions a { still calls the expression before it
+    auto call = Parser{"while (f{a}) {g{b}}"}.statement();
+    ASSERT_TRUE(call.has_value());
+    const auto& call_stmt = std::get<ast::Forward<ast::WhileStmt>>(call.value());
+    EXPECT_TRUE(std::holds_alternative<ast::Forward<ast::FunctionCall>>(call_stmt->getCondition()));
+    ASSERT_EQ(call_stmt->getBody().size(), 1);
+
+    auto two = Parser{"while a {\n\nlet b = a; b\n;\n}"}.statement();
+    ASSERT_TRUE(two.has_value());
+    EXPECT_EQ(std::get<ast::Forward<ast::WhileStmt>>(two.value())->getBody().size(), 2);
+}
+
+TEST(StatementParserTest, IfStmtTest)
+{
+    auto result = Parser{"if a {\nlet b = a\n} elif b {\nb\n} else {\n1; 2\n}"}.statement();
+    ASSERT_TRUE(result.has_value());
+    ASSERT_TRUE(std::holds_alternative<ast::Forward<ast::IfStmt>>(result.value()));
+
+    const auto& stmt = std::get<ast::Forward<ast::IfStmt>>(result.value());
+    EXPECT_EQ(stmt->getBody().size(), 1);
+    ASSERT_EQ(stmt->getElifs().size(), 1);
+    EXPECT_EQ(stmt->getElifs().front().getBody().size(), 1);
+    ASSERT_TRUE(stmt->getElse().has_value());
+    EXPECT_EQ(stmt->getElse()->getBody().size(), 2);
+}
+
+TEST(StatementParserTest, StmtErrorTest)
+{
+    auto render = [](std::string_view text) {
+        auto result = Parser{text}.statement();
+        EXPECT_FALSE(result.has_value());
+        return result.has_value() ? std::string{} : common::error::render(result.error(), lexing::LineIndex{text});
+    };
+
+    EXPECT_EQ(render("while a {\n1 2\n}"), "2:3: unexpected INTEGER, expected one of NEWLINE, R_BRACKET, SEMICOLON");
+    EXPECT_TRUE(render("while a {\n1\n").starts_with("3:1: unexpected <EOF>, expected one of"));
+}
@@ -0,0 +1,162 @@
+#include <common/Diagnostic.hpp>
+#include <lexer/LineIndex.hpp>
+#include <parser/Parser.hpp>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+using parser::Parser;
+
+namespace {
+
+auto id(std::string_view text) -> ast::Identifier
+{
+    return ast::Identifier{{0, 0}, text};
+}
+
+auto namedT(std::string_view name) -> ast::Type
+{
+    return ast::NamedType{{0, 0}, {}, id(name)};
+}
+
+auto param(std::string_view name, ast::Type type) -> ast::FunctionParameter
+{
+    return ast::FunctionParameter{{0, 0}, id(name), std::move(type)};
+}
+
+auto let(std::string_view name, ast::Expression rhs) -> ast::ToplevelElement
+{
+    return ast::forward<ast::LetAssignment>(lexing::TextArea{0, 0},
+                                            id(name),
+                                            std::nullopt,
+                                            std::move(rhs));
+}
+
+auto fun(std::string_view name,
+         std::vector<ast::FunctionParameter> params,
+         ast::Type return_type,
+         ast::Expression body) -> ast::ToplevelElement
+{
+    std::vector<ast::FunctionStatement> statements;
+    statements.emplace_back(std::move(body));
+
+    return ast::forward<ast::FunctionDefinition>(lexing::TextArea{0, 0},
+                                                 id(name),
+                                                 std::move(params),
+                                                 std::move(return_type),
+                                                 std::move(statements));
+}
+
+auto namespace_(std::string_view name, auto... elements) -> ast::ToplevelElement
+{
+    std::vector<ast::ToplevelElement> elems;
+    (elems.emplace_back(std::move(elements)), ...);
+
+    return ast::forward<ast::Namespace>(lexing::TextArea{0, 0}, id(name), std::move(elems));
+}
+
+auto toplevel_test_positive(std::string_view text, auto... expected)
+{
+    std::vector<ast::ToplevelElement> elements;
+    (elements.emplace_back(std::move(expected)), ...);
+
+    auto result = Parser{text}.toplevel();
+
+    ASSERT_TRUE(result.has_value()) << text;
+    EXPECT_EQ(result.value(), elements) << text;
+}
+
+auto toplevel_test_negative(std::string_view text, std::string_view message)
+{
+    auto result = Parser{text}.toplevel();
+
+    ASSERT_FALSE(result.has_value()) << text;
+    EXPECT_EQ(common::error::render(result.error(), lexing::LineIndex{text}), message);
+}
+
+} // namespace
+
+TEST(ToplevelParserTest, LetTest)
+{
+    toplevel_test_positive("");
+    toplevel_test_positive("\n;\n");
+    toplevel_test_positive("\nlet a = 1; let b = a\n\n", let("a", ast::Integer{{0, 0}, 1}), let("b", id("a")));
+
+    auto result = Parser{"let c = {let d = b\nlet e = d\n=> e}\n"}.toplevel();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(result.value().size(), 1);
+}
+
+TEST(ToplevelParserTest, FunctionTest)
+{
+    toplevel_test_positive("fun f(): Int = x",
+                           fun("f", {}, namedT("Int"), id("x")));
+
+    std::vector<ast::FunctionParameter> params;
+    params.emplace_back(param("a", namedT("Int")));
+    params.emplace_back(param("b", namedT("Double")));
+    toplevel_test_positive("fun add(a: Int, b: Double): Double = b\nlet x = y",
+                           fun("add", std::move(params), namedT("Double"), id("b")),
+                           let("x", id("y")));
+
+    auto block = Parser{"fun f(a: Int): Int => Int = {let b = a\n=> (x) => b}"}.toplevel();
+    ASSERT_TRUE(block.has_value());
+    ASSERT_EQ(block.value().size(), 1);
+
+    const auto& function = std::get<ast::Forward<ast::FunctionDefinition>>(block.value().front());
+    EXPECT_EQ(function->getName(), id("f"));
+    EXPECT_EQ(function->getParameters().size(), 1);
+    EXPECT_TRUE(std::holds_alternative<ast::Forward<ast::LambdaType>>(function->getReturnType()));
+    ASSERT_EQ(function->getBody().size(), 1);
+    EXPECT_EQ(function->getArea(), (lexing::TextArea{0, 51}));
+}
+
+TEST(ToplevelParserTest, NamespaceTest)
+{
+    toplevel_test_positive("namespace a {}", namespace_("a"));
+
+    toplevel_test_positive("namespace outer {\n  let a = b\n\n  namespace inner { fun f(): T = a }\n}; let c = d",
+                           namespace_("outer",
+                                      let("a", id("b")),
+                                      namespace_("inner",
+                                                 fun("f", {}, namedT("T"), id("a")))),
+                           let("c", id("d")));
+
+    auto result = Parser{"namespace a { let b = c }"}.toplevel();
+    ASSERT_TRUE(result.has_value());
+    EXPECT_EQ(ast::getTextArea(result.value().front()), (lexing::TextArea{0, 25}));
+}
+
+TEST(ToplevelParserTest, ToplevelNegativeTest)
+{
+    toplevel_test_negative("let a = 1 let b = 2",
+                           "1:11: unexpected LET, expected one of NEWLINE, SEMICOLON, <EOF>");
+    toplevel_test_negative("type T = Int", "1:1: unexpected TYPE, expected one of LET, FUN, NAMESPACE");
+    toplevel_test_negative("fun f(a): Int = a", "1:8: unexpected R_PARANTHESIS, expected COLON");
+    toplevel_test_negative("fun f(a: Int b: Int): Int = a",
+                           "1:14: unexpected IDENTIFIER, expected one of R_PARANTHESIS, COMMA");
+    toplevel_test_negative("fun f() = a", "1:9: unexpected ASSIGN, expected COLON");
+    toplevel_test_negative("fun f(): Int\n= a", "1:13: unexpected NEWLINE, expected ASSIGN");
+    toplevel_test_negative("namespace a { let b = c let d = e }",
+                           "1:25: unexpected LET, expected one of NEWLINE, R_BRACKET, SEMICOLON");
+    toplevel_test_negative("namespace a {\nlet b = c\n", "3:1: unexpected <EOF>, expected one of LET, FUN, NAMESPACE");
+    toplevel_test_negative("namespace { }", "1:11: unexpected L_BRACKET, expected IDENTIFIER");
+}
+
+TEST(ToplevelParserTest, NestedNamespaceLimitTest)
+{
+    std::string source;
+    for(int i = 0; i < 300; i++) {
+        source += "namespace n {";
+    }
+    source += std::string(300, '}');
+
+    auto result = Parser{source}.toplevel();
+    ASSERT_FALSE(result.has_value());
+    EXPECT_TRUE(std::holds_alternative<common::error::NestingTooDeep>(result.error()));
+
+    auto raised = Parser{source}.set_max_nesting_depth(512).toplevel();
+    EXPECT_TRUE(raised.has_value());
+}
@@ -0,0 +1,166 @@
+#include <algorithm>
+#include <ast/Arena.hpp>
+#include <ast/flat/FlatAst.hpp>
+#include <ast/flat/Flatten.hpp>
+#include <common/Interner.hpp>
+#include <optional>
+#include <parser/Parser.hpp>
+#include <parser/ToplevelStream.hpp>
+#include <string>
+#include <string_view>
+#include <utils/ToplevelUtils.hpp>
+#include <variant>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace {
+
+// streams all elements of source and compares them to the ones of Parser::toplevel
+auto expect_same_elements(std::string_view source) -> void
+{
+    std::vector<ast::ToplevelElement> elements;
+    std::optional<common::error::Error> error;
+
+    for(auto& result : parser::ToplevelStream{source, parser::RetainElements{}}) {
+        if(not result.has_value()) {
+            error = std::move(result.error());
+            continue;
+        }
+        ASSERT_FALSE(error.has_value()) << "element after an error";
+        elements.emplace_back(std::move(result.value()));
+    }
+
+    tests::expect_same_elements(source, parser::Parser{source}.toplevel(), elements, error);
+}
+
+} // namespace
+
+TEST(ToplevelStreamTest, SameElementsAsToplevelTest)
+{
+    expect_same_elements("");
+    expect_same_elements("\n\n;\n");
+    expect_same_elements("let a = 1");
+    expect_same_elements("let a = 1; let b = a\nlet c = {let d = b\nlet e = d\n=> e}\n");
+    expect_same_elements(tests::generate_toplevel_source(200));
+}
+
+TEST(ToplevelStreamTest, FirstErrorIsReportedTest)
+{
+    const auto source = tests::generate_toplevel_source(50);
+
+    expect_same_elements(source + "let broken = (1 +\nlet x = 2\n" + source);
+    expect_same_elements(source + "let also_broken = ) 1\n" + source);
+    expect_same_elements(source + "let a = 1 let b = 2\n" + source);
+    expect_same_elements(source + "fun f() => 1\n" + source);
+    expect_same_elements(source + "namespace n {\nlet x = 1\n" + source);
+    expect_same_elements(source + "type T = Int\n" + source);
+    expect_same_elements(source + "let s = \"never closed\n" + source);
+    expect_same_elements(source + "let s = (1 + \"never closed\n" + source);
+}
+
+TEST(ToplevelStreamTest, NextTest)
+{
+    parser::ToplevelStream stream{"let a = 1\nlet b = 2; let c = 3\nlet d = 4 5"};
+
+    for(std::string_view name : {"a", "b", "c"}) {
+        auto element = stream.next();
+        ASSERT_TRUE(element.has_value());
+        ASSERT_TRUE(element.value().has_value());
+        const auto& let = std::get<ast::Forward<ast::LetAssignment>>(element.value().value());
+        EXPECT_EQ(let->getName().getValue(stream.get_interner()), name);
+    }
+
+    auto error = stream.next();
+    ASSERT_TRUE(error.has_value());
+    EXPECT_FALSE(error.value().has_value());
+
+    EXPECT_FALSE(stream.next().has_value());
+    EXPECT_FALSE(stream.next().has_value());
+}
+
+TEST(ToplevelStreamTest, ArenaIsReusedTest)
+{
+    const auto source = tests::generate_toplevel_source(400);
+    ast::Arena arena;
+    common::Interner interner;
+
+    std::size_t count = 0;
+    for(auto& result : parser::ToplevelStream{source, arena, interner}) {
+        ASSERT_TRUE(result.has_value());
+        std::visit(
+            [](const auto& element) {
+                if constexpr(requires { element.is_arena_owned(); }) {
+                    EXPECT_TRUE(element.is_arena_owned());
+                }
+            },
+            result.value());
+        // a single element always fits into the first block of the arena
+        EXPECT_EQ(arena.get_block_count(), 1);
+        count++;
+    }
+
+    EXPECT_EQ(count, parser::Parser{source}.toplevel().value().size());
+}
+
+TEST(ToplevelStreamTest, InternerIsBoundedTest)
+{
+    // every element introduces new names like the generated modules of the benchmarks
+    std::string source;
+    for(std::size_t i = 0; i < 5000; i++) {
+        const auto n = std::to_string(i);
+        source += "let value_" + n + " = other_" + n + " + 1\n";
+        source += "fun function_" + n + "(argument_" + n + ": Int): Int = argument_" + n + "\n";
+    }
+
+    ast::Arena arena;
+    common::Interner interner;
+    const auto global_size = common::Interner::global().size();
+
+    std::size_t count = 0;
+    std::size_t max_size = 0;
+    for(auto& result : parser::ToplevelStream{source, arena, interner}) {
+        ASSERT_TRUE(result.has_value());
+        max_size = std::max(max_size, interner.size());
+
+        if(std::holds_alternative<ast::Forward<ast::LetAssignment>>(result.value())) {
+            const auto& let = std::get<ast::Forward<ast::LetAssignment>>(result.value());
+            EXPECT_EQ(let->getName().getValue(interner), "value_" + std::to_string(count / 2));
+        }
+        count++;
+    }
+
+    EXPECT_EQ(count, 10000);
+    // the names of a single element at most
+    EXPECT_LE(max_size, 3);
+    EXPECT_EQ(common::Interner::global().size(), global_size);
+}
+
+TEST(ToplevelStreamTest, BoundedByDefaultTest)
+{
+    std::string source;
+    for(std::size_t i = 0; i < 1000; i++) {
+        source += "let value_" + std::to_string(i) + " = other_" + std::to_string(i) + " + 1\n";
+    }
+
+    const auto global_size = common::Interner::global().size();
+    parser::ToplevelStream stream{source};
+
+    std::size_t count = 0;
+    while(auto result = stream.next()) {
+        ASSERT_TRUE(result.value().has_value());
+        const auto& let = std::get<ast::Forward<ast::LetAssignment>>(result.value().value());
+        EXPECT_TRUE(let.is_arena_owned());
+        EXPECT_LE(stream.get_interner().size(), 2);
+
+        // the names are looked up in the interner of the stream
+        ast::flat::FlatAst flat;
+        auto root = ast::flat::flatten(let->getRightHandSide(), flat, stream.get_interner());
+        auto [lhs, rhs] = flat.get_pair(root);
+        EXPECT_EQ(flat.get_text(lhs), "other_" + std::to_string(count));
+        count++;
+    }
+
+    EXPECT_EQ(count, 1000);
+    EXPECT_EQ(common::Interner::global().size(), global_size);
+}
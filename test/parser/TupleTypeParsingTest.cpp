@@ -1,8 +1,10 @@
 #include <ast/Ast.hpp>
 #include <ast/Forward.hpp>
+#include <common/Diagnostic.hpp>
 #include <concepts>
 #include <iostream>
 #include <lexer/Lexer.hpp>
+#include <lexer/LineIndex.hpp>
 #include <parser/Parser.hpp>
 
 #include <gtest/gtest.h>
@@ -102,3 +104,16 @@ TEST(TupleTypeParsingTest, TupleTypeParsingNegativeTest)
     tuple_type_test_negative("(a)");
     tuple_type_test_negative("(a)?");
 }
+
+TEST(TupleTypeParsingTest, TupleTypeErrorPositionTest)
+{
+    auto render = [](std::string_view text) {
+        auto result = Parser{text}.type();
+        EXPECT_FALSE(result.has_value());
+        return result.has_value() ? std::string{} : common::error::render(result.error(), lexing::LineIndex{text});
+    };
+
+    // the error points at the first token which does not fit, not at the token after it
+    EXPECT_EQ(render("(a b)"), "1:4: unexpected IDENTIFIER, expected one of R_PARANTHESIS, BITWISE_OR, BITWISE_AND, COMMA");
+    EXPECT_EQ(render("(a & ) x"), "1:6: unexpected R_PARANTHESIS, expected one of L_PARANTHESIS, SELF_TYPE, IDENTIFIER");
+}
@@ -0,0 +1,81 @@
+#pragma once
+
+#include <ast/Ast.hpp>
+#include <common/Diagnostic.hpp>
+#include <common/Error.hpp>
+#include <cstddef>
+#include <expected>
+#include <lexer/LineIndex.hpp>
+#include <optional>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+#include <gtest/gtest.h>
+
+namespace tests {
+
+// generates top level elements spanning multiple lines, blocks and namespaces contain
+// lets and functions at the start of a line which must not be mistaken for top level elements.
+// elements inside of blocks and namespaces are always named x, y, z, let_, g or inner
+inline auto generate_toplevel_source(std::size_t lines) -> std::string
+{
+    std::string source;
+    for(std::size_t i = 0; i < lines; i++) {
+        const auto n = std::to_string(i);
+        switch(i % 7) {
+        case 0:
+            source += "let a" + n + " = b + 42 * 3.5\n";
+            break;
+        case 1:
+            source += "let b" + n + ": Int = {let x = " + n + "\nlet y = {let x = 2\n=> x}\n=> x * y}\n\n";
+            break;
+        case 2:
+            source += "let c" + n + " = (x, y) => x - y; let d" + n + " = f(1, 2)\n";
+            break;
+        case 3:
+            source += "let e" + n + " = if(x <= 1) { => self } else { => \"let\" }\n";
+            break;
+        case 4:
+            source += "fun f" + n + "(a: Int, b: (Int & Int)): Int => Int = {let x = a\nlet y = b\n=> (z) => x}; ";
+            source += "namespace m" + n + " {\n let x = 1\n}\n";
+            break;
+        case 5:
+            source += "namespace n" + n + " {\n  let let_ = 1\n  fun g(): T = let_\n\n";
+            source += "  namespace inner { namespace inner {\nfun g(): Int = 1\n\n}; let x = y }\n}\n";
+            break;
+        default:
+            source += "\n  ;\n";
+            break;
+        }
+    }
+    return source;
+}
+
+inline auto render(std::string_view source, const common::error::Error& error) -> std::string
+{
+    return common::error::render(error, lexing::LineIndex{source});
+}
+
+// compares the elements or the error of parsing source in another way to the result of Parser::toplevel
+inline auto expect_same_elements(std::string_view source,
+                                 const std::expected<std::vector<ast::ToplevelElement>, common::error::Error>& serial,
+                                 std::span<const ast::ToplevelElement> elements,
+                                 const std::optional<common::error::Error>& error) -> void
+{
+    ASSERT_EQ(error.has_value(), not serial.has_value());
+
+    if(error.has_value()) {
+        EXPECT_EQ(render(source, error.value()), render(source, serial.error()));
+        return;
+    }
+
+    ASSERT_EQ(elements.size(), serial.value().size());
+    for(std::size_t i = 0; i < elements.size(); i++) {
+        ASSERT_EQ(elements[i], serial.value()[i]) << "element " << i;
+        ASSERT_EQ(ast::getTextArea(elements[i]), ast::getTextArea(serial.value()[i])) << "element " << i;
+    }
+}
+
+} // namespace tests